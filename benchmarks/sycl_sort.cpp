@@ -31,6 +31,7 @@
 #include <string>
 #include <iostream>
 #include <numeric>
+#include <cstdlib>
 
 #include <experimental/algorithm>
 #include <sycl/execution_policy>
@@ -39,16 +40,20 @@
 
 using namespace sycl::helpers;
 
+/* The keys are ints sorted with the default comparison, so the radix sort
+ * is used. benchmarks/sycl_sort_comparison.cpp sorts the same keys with a
+ * user comparison, which uses the bitonic sort.
+ */
 benchmark<>::time_units_t benchmark_sort(const unsigned numReps,
                                          const unsigned num_elems,
                                          const cli_device_selector cds) {
+  std::vector<int> input(num_elems);
+  std::srand(1);
+  std::generate(input.begin(), input.end(), std::rand);
   std::vector<int> v1;
 
-  for (int i = num_elems; i > 0; i--) {
-    v1.push_back(i);
-  }
-
   auto mysort = [&]() {
+    v1 = input;
     cl::sycl::queue q(cds);
     sycl::sycl_execution_policy<class SortAlgorithm1> snp(q);
     std::experimental::parallel::sort(snp, begin(v1), end(v1));
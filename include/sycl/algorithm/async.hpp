@@ -0,0 +1,274 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_ASYNC__
+#define __SYCL_IMPL_ALGORITHM_ASYNC__
+
+#include <type_traits>
+#include <algorithm>
+#include <iterator>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_future.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+#include <sycl/algorithm/transform.hpp>
+#include <sycl/algorithm/for_each.hpp>
+#include <sycl/algorithm/fill.hpp>
+#include <sycl/algorithm/sort.hpp>
+
+/** async_name.
+ * Class used to name the kernels the asynchronous algorithms add to the
+ * ones of the synchronous algorithms.
+ */
+template <typename T>
+class async_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+
+template <class KernelName>
+class sycl_execution_policy;
+
+namespace impl {
+
+/* async_transform.
+ * @brief Applies an Unary Operator to [b, e) without waiting for it.
+ * @return A handle whose get() returns the end of the output range
+ */
+template <class ExecutionPolicy, class Iterator, class OutputIterator,
+          class UnaryOperation>
+sycl::helpers::sycl_future<OutputIterator> async_transform(
+    ExecutionPolicy &sep, Iterator b, Iterator e, OutputIterator out,
+    UnaryOperation op) {
+  cl::sycl::queue q(sep.get_queue());
+  auto vectorSize = sycl::helpers::distance(b, e);
+  auto last = out;
+  std::advance(last, vectorSize);
+  if (vectorSize < 1) {
+    return sycl::helpers::make_sycl_future<OutputIterator>(
+        cl::sycl::event(), [last]() { return last; });
+  }
+  auto bufI = sycl::helpers::make_const_buffer(b, e);
+  auto bufO = sycl::helpers::make_buffer(out, last);
+  auto event = buffer_transform(sep, q, bufI, bufO, op);
+  return sycl::helpers::make_sycl_future<OutputIterator>(
+      event, [last]() { return last; }, bufI, bufO);
+}
+
+/* async_for_each.
+ * @brief Applies a function to every element of [b, e) without waiting
+ * for it.
+ */
+template <class ExecutionPolicy, class Iterator, class UnaryFunction>
+sycl::helpers::sycl_future<void> async_for_each(ExecutionPolicy &sep,
+                                                Iterator b, Iterator e,
+                                                UnaryFunction op) {
+  cl::sycl::queue q(sep.get_queue());
+  if (sycl::helpers::distance(b, e) < 1) {
+    return sycl::helpers::make_sycl_future<void>(cl::sycl::event(), []() {});
+  }
+  auto bufI = sycl::helpers::make_buffer(b, e);
+  auto event = buffer_for_each(sep, q, bufI, op);
+  return sycl::helpers::make_sycl_future<void>(event, []() {}, bufI);
+}
+
+/* async_fill.
+ * @brief Fills [b, e) with value without waiting for it.
+ */
+template <class ExecutionPolicy, class ForwardIt, class T>
+sycl::helpers::sycl_future<void> async_fill(ExecutionPolicy &sep,
+                                            ForwardIt b, ForwardIt e,
+                                            const T &value) {
+  cl::sycl::queue q(sep.get_queue());
+  if (sycl::helpers::distance(b, e) < 1) {
+    return sycl::helpers::make_sycl_future<void>(cl::sycl::event(), []() {});
+  }
+  auto bufI = sycl::helpers::make_buffer(b, e);
+  auto event = buffer_fill(sep, q, bufI, value);
+  return sycl::helpers::make_sycl_future<void>(event, []() {}, bufI);
+}
+
+/* async_reduce.
+ * @brief Reduces [b, e) with bop without waiting for it.
+ * The result stays on the device until get() is called.
+ * @return A handle whose get() returns the reduction of init and the range
+ */
+template <class ExecutionPolicy, class Iterator, class T,
+          class BinaryOperation>
+sycl::helpers::sycl_future<T> async_reduce(ExecutionPolicy &sep, Iterator b,
+                                           Iterator e, T init,
+                                           BinaryOperation bop) {
+  typedef typename std::iterator_traits<Iterator>::value_type value_type;
+  typedef async_name<typename ExecutionPolicy::kernelName> kernelName;
+  using MarkerName = cl::sycl::helpers::NameGen<0, kernelName, T>;
+  using ReduceName = cl::sycl::helpers::NameGen<1, kernelName>;
+
+  cl::sycl::queue q(sep.get_queue());
+  auto size = sycl::helpers::distance(b, e);
+  if (size <= 0) {
+    return sycl::helpers::make_sycl_future<T>(cl::sycl::event(),
+                                              [init]() { return init; });
+  }
+
+  auto d = compute_mapreduce_descriptor(q.get_device(), size,
+                                        sizeof(value_type));
+  auto input_buff = sycl::helpers::make_const_buffer(b, e);
+  sycl_execution_policy<ReduceName> rsep(q);
+  auto result_buff = impl::buffer_mapreduce_device(
+      rsep, q, input_buff, init, d, [](size_t, value_type x) { return x; },
+      bop);
+  auto event = sycl::helpers::submit_marker<MarkerName>(q, result_buff);
+  return sycl::helpers::make_sycl_future<T>(
+      event,
+      [result_buff]() mutable {
+        auto r = result_buff.template get_access
+          <cl::sycl::access::mode::read>();
+        return r[0];
+      },
+      input_buff);
+}
+
+/* async_sort.
+ * @brief Sorts [first, last) without waiting for it.
+ */
+template <class ExecutionPolicy, class RandomIt>
+sycl::helpers::sycl_future<void> async_sort(ExecutionPolicy &sep,
+                                            RandomIt first, RandomIt last) {
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  typedef async_name<typename ExecutionPolicy::kernelName> kernelName;
+  using MarkerName = cl::sycl::helpers::NameGen<0, kernelName, type_>;
+
+  cl::sycl::queue q(sep.get_queue());
+  auto vectorSize = sycl::helpers::distance(first, last);
+  if (vectorSize < 1) {
+    return sycl::helpers::make_sycl_future<void>(cl::sycl::event(), []() {});
+  }
+  size_t offset;
+  auto buf = sycl::helpers::make_inplace_buffer(first, last, offset);
+  buffer_sort(sep, q, buf, offset, vectorSize);
+  auto event = sycl::helpers::submit_marker<MarkerName>(q, buf);
+  return sycl::helpers::make_sycl_future<void>(event, []() {}, buf);
+}
+
+/* async_sort.
+ * @brief Sorts [first, last) with the Comp Operator without waiting for it.
+ */
+template <class ExecutionPolicy, class RandomIt, class CompareOp>
+sycl::helpers::sycl_future<void> async_sort(ExecutionPolicy &sep,
+                                            RandomIt first, RandomIt last,
+                                            CompareOp comp) {
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  typedef async_name<typename ExecutionPolicy::kernelName> kernelName;
+  using MarkerName = cl::sycl::helpers::NameGen<0, kernelName, type_>;
+
+  cl::sycl::queue q(sep.get_queue());
+  auto vectorSize = sycl::helpers::distance(first, last);
+  if (vectorSize < 1) {
+    return sycl::helpers::make_sycl_future<void>(cl::sycl::event(), []() {});
+  }
+  size_t offset;
+  auto buf = sycl::helpers::make_inplace_buffer(first, last, offset);
+  buffer_sort(sep, q, buf, offset, vectorSize, comp);
+  auto event = sycl::helpers::submit_marker<MarkerName>(q, buf);
+  return sycl::helpers::make_sycl_future<void>(event, []() {}, buf);
+}
+
+/*
+ * Scan shared by the async_inclusive_scan overloads, starting from init
+ * when has_init is true and from the first element otherwise
+ */
+template <class ExecutionPolicy, class InputIterator, class OutputIterator,
+          class BinaryOperation>
+sycl::helpers::sycl_future<OutputIterator> async_inclusive_scan_from(
+    ExecutionPolicy &sep, InputIterator b, InputIterator e, OutputIterator o,
+    typename std::iterator_traits<InputIterator>::value_type init,
+    bool has_init, BinaryOperation bop) {
+  typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+  typedef async_name<typename ExecutionPolicy::kernelName> kernelName;
+  using MarkerName = cl::sycl::helpers::NameGen<0, kernelName, value_type>;
+  using ScanName = cl::sycl::helpers::NameGen<2, kernelName>;
+
+  cl::sycl::queue q(sep.get_queue());
+  size_t size = sycl::helpers::distance(b, e);
+  auto last = std::next(o, size);
+  if (size == 0) {
+    return sycl::helpers::make_sycl_future<OutputIterator>(
+        cl::sycl::event(), [last]() { return last; });
+  }
+
+  auto bufI = sycl::helpers::make_const_buffer(b, e);
+  auto bufO = sycl::helpers::make_buffer(o, last);
+  auto d = compute_mapscan_descriptor(q.get_device(), size,
+                                      sizeof(value_type));
+  sycl_execution_policy<ScanName> ssep(q);
+  impl::buffer_mapscan_single_pass(ssep, q, bufI, bufO, init, d,
+                                   [](value_type x) { return x; }, bop,
+                                   false, has_init);
+  auto event = sycl::helpers::submit_marker<MarkerName>(q, bufO);
+  return sycl::helpers::make_sycl_future<OutputIterator>(
+      event, [last]() { return last; }, bufI, bufO);
+}
+
+/* async_inclusive_scan.
+ * @brief Computes the inclusive scan of [b, e) and init into o without
+ * waiting for it. The scan is computed with buffer_mapscan_single_pass
+ * whatever the configuration.
+ * @return A handle whose get() returns the end of the output range
+ */
+template <class ExecutionPolicy, class InputIterator, class OutputIterator,
+          class T, class BinaryOperation>
+sycl::helpers::sycl_future<OutputIterator> async_inclusive_scan(
+    ExecutionPolicy &sep, InputIterator b, InputIterator e, OutputIterator o,
+    T init, BinaryOperation bop) {
+  typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+  return async_inclusive_scan_from(sep, b, e, o,
+                                   static_cast<value_type>(init), true, bop);
+}
+
+/* async_inclusive_scan.
+ * @brief Computes the inclusive scan of [b, e) into o without waiting for
+ * it. The scan starts from the first element on the device, so bop needs
+ * no identity.
+ * @return A handle whose get() returns the end of the output range
+ */
+template <class ExecutionPolicy, class InputIterator, class OutputIterator,
+          class BinaryOperation>
+sycl::helpers::sycl_future<OutputIterator> async_inclusive_scan(
+    ExecutionPolicy &sep, InputIterator b, InputIterator e, OutputIterator o,
+    BinaryOperation bop) {
+  typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+  return async_inclusive_scan_from(sep, b, e, o, value_type(), false, bop);
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_ASYNC__
@@ -30,9 +30,12 @@
 #define __SYCL_IMPL_BUFFER_ALGORITHM__
 
 #include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_device_info.hpp>
 #include <sycl/helpers/sycl_namegen.hpp>
 
 #include <cassert>
+#include <map>
+#include <mutex>
 
 namespace sycl {
 namespace impl {
@@ -64,13 +67,67 @@ struct sycl_algorithm_descriptor {
     nb_work_item(nb_work_item_) {}
 };
 
+/*
+ * Descriptors already computed, by device, algorithm, size and sizeof(B).
+ * Sizes vary from call to call, so the cache is emptied when it is full
+ * rather than growing without bound.
+ */
+enum descriptor_kind {
+  descriptor_mapreduce = 0,
+  descriptor_mapscan = 1
+};
+
+struct descriptor_key {
+  size_t device, kind, size, sizeofB;
+
+  bool operator<(const descriptor_key &other) const {
+    if (device != other.device) return device < other.device;
+    if (kind != other.kind) return kind < other.kind;
+    if (size != other.size) return size < other.size;
+    return sizeofB < other.sizeofB;
+  }
+};
+
+const size_t descriptor_cache_capacity = 1024;
+
+inline std::mutex &descriptor_cache_mutex() {
+  static std::mutex m;
+  return m;
+}
+
+inline std::map<descriptor_key, sycl_algorithm_descriptor> &
+descriptor_cache() {
+  static std::map<descriptor_key, sycl_algorithm_descriptor> cache;
+  return cache;
+}
+
+/*
+ * Returns the descriptor of the key from the cache, computing it with
+ * compute the first time
+ */
+template <typename Compute>
+sycl_algorithm_descriptor memoise_descriptor(descriptor_key key,
+                                             Compute compute) {
+  std::lock_guard<std::mutex> lock(descriptor_cache_mutex());
+  auto &cache = descriptor_cache();
+  auto it = cache.find(key);
+  if (it != cache.end())
+    return it->second;
+  if (cache.size() >= descriptor_cache_capacity)
+    cache.clear();
+  sycl_algorithm_descriptor d = compute();
+  cache.insert(std::make_pair(key, d));
+  return d;
+}
+
 /*
  * Compute a valid set of parameters for buffer_mapreduce algorithm to
  * work properly
  */
-sycl_algorithm_descriptor compute_mapreduce_descriptor(cl::sycl::device device,
-                                                  size_t size,
-                                                  size_t sizeofB) {
+sycl_algorithm_descriptor compute_mapreduce_descriptor(
+    const sycl::helpers::device_info &device,
+    size_t size,
+    size_t sizeofB) {
   using std::max;
   using std::min;
   if (size <= 0) {
@@ -84,17 +141,9 @@ sycl_algorithm_descriptor compute_mapreduce_descriptor(cl::sycl::device device,
        local_mem_size
    *  - every work group do something
    */
-  size_t max_work_group =
-    device.get_info<cl::sycl::info::device::max_compute_units>();
-
-  const cl::sycl::id<3>max_work_item_sizes =
-    device.get_info<cl::sycl::info::device::max_work_item_sizes>();
-  const auto max_work_item = min(
-    device.get_info<cl::sycl::info::device::max_work_group_size>(),
-    max_work_item_sizes[0]);
-
-  size_t local_mem_size =
-    device.get_info<cl::sycl::info::device::local_mem_size>();
+  size_t max_work_group = device.max_compute_units;
+  const auto max_work_item = device.max_work_group_size;
+  size_t local_mem_size = device.local_mem_size;
 
   size_t nb_work_item = min(max_work_item, local_mem_size / sizeofB);
 
@@ -139,12 +188,70 @@ sycl_algorithm_descriptor compute_mapreduce_descriptor(cl::sycl::device device,
     nb_work_item };
 }
 
+/*
+ * Same as above, with the capabilities of the device read from the cache
+ * and the descriptor memoised
+ */
+inline sycl_algorithm_descriptor compute_mapreduce_descriptor(
+    cl::sycl::device device,
+    size_t size,
+    size_t sizeofB) {
+  auto info = sycl::helpers::get_device_info(device);
+  return memoise_descriptor(
+      descriptor_key { info.key, descriptor_mapreduce, size, sizeofB },
+      [&]() { return compute_mapreduce_descriptor(info, size, sizeofB); });
+}
+
+/*
+ * Stores a value computed on the host in a one-element buffer, for the
+ * cases where the reductions below fall back to the host
+ */
+template <typename B>
+cl::sycl::buffer<B, 1> make_result_buffer(B value) {
+  cl::sycl::buffer<B, 1> result_buff { cl::sycl::range<1> { 1 } };
+  auto write_result = result_buff.template get_access
+    <cl::sycl::access::mode::write>();
+  write_result[0] = value;
+  return result_buff;
+}
+
+/*
+ * Combines the partial results of the work-groups with init on the device,
+ * and stores the result in a one-element buffer
+ */
+template <typename KernelName,
+          typename B,
+          typename Reduce>
+cl::sycl::buffer<B, 1> buffer_combine(cl::sycl::queue q,
+                                      cl::sycl::buffer<B, 1> partial_buff,
+                                      size_t nb_partial,
+                                      B init,
+                                      Reduce reduce) {
+  cl::sycl::buffer<B, 1> result_buff { cl::sycl::range<1> { 1 } };
+  q.submit([&] (cl::sycl::handler &cgh) {
+    auto partial = partial_buff.template get_access
+      <cl::sycl::access::mode::read>(cgh);
+    auto result = result_buff.template get_access
+      <cl::sycl::access::mode::write>(cgh);
+    cgh.single_task<KernelName>([=]() {
+      B acc = init;
+      for (size_t pos = 0; pos < nb_partial; pos++)
+        acc = reduce(acc, partial[pos]);
+      result[0] = acc;
+    });
+  });
+  return result_buff;
+}
+
 /*
  * MapReduce Algorithm applied on a buffer
  *
  * with map/reduce functions typed as follow
  * Map    : A -> B
  * Reduce : B -> B -> B
+ *
+ * The result is left on the device, in a one-element buffer: the host only
+ * waits for it when it reads it.
  */
 
 template <typename ExecutionPolicy,
@@ -152,13 +259,13 @@ template <typename ExecutionPolicy,
           typename B,
           typename Reduce,
           typename Map>
-B buffer_mapreduce(ExecutionPolicy &snp,
-                   cl::sycl::queue q,
-                   cl::sycl::buffer<A, 1> input_buff,
-                   B init, //map is not applied on init
-                   sycl_algorithm_descriptor d,
-                   Map map,
-                   Reduce reduce) {
+cl::sycl::buffer<B, 1> buffer_mapreduce_device(ExecutionPolicy &snp,
+                                               cl::sycl::queue q,
+                                               cl::sycl::buffer<A, 1> input_buff,
+                                               B init, //map is not applied on init
+                                               sycl_algorithm_descriptor d,
+                                               Map map,
+                                               Reduce reduce) {
 
   /*
    * 'map' is not applied on init
@@ -173,13 +280,13 @@ B buffer_mapreduce(ExecutionPolicy &snp,
     for (size_t pos = 0; pos < d.size; pos++)
       acc = reduce(acc, map(pos, read_input[pos]));
 
-    return acc;
+    return make_result_buffer(acc);
   }
 
   using std::min;
   using std::max;
 
-  cl::sycl::buffer<B, 1> output_buff { cl::sycl::range<1> { d.nb_work_group } };
+  auto output_buff = sycl::helpers::make_temp_buffer<B>(d.nb_work_group);
 
   q.submit([&] (cl::sycl::handler &cgh) {
     cl::sycl::range<1> rg { d.nb_work_group * d.nb_work_item };
@@ -221,15 +328,34 @@ B buffer_mapreduce(ExecutionPolicy &snp,
       output[group_id] = acc;
     });
   });
-  auto read_output = output_buff.template get_access
-    <cl::sycl::access::mode::read>();
 
-  B acc = init;
-  for (size_t pos0 = 0; pos0 < d.nb_work_group; pos0++) {
-    acc = reduce(acc, read_output[pos0]);
-  }
+  return buffer_combine<cl::sycl::helpers::NameGen<2,
+                          typename ExecutionPolicy::kernelName, B>>(
+      q, output_buff, d.nb_work_group, init, reduce);
+}
 
-  return acc;
+/*
+ * MapReduce Algorithm applied on a buffer
+ *
+ * Same as buffer_mapreduce_device, returning the result to the host
+ */
+template <typename ExecutionPolicy,
+          typename A,
+          typename B,
+          typename Reduce,
+          typename Map>
+B buffer_mapreduce(ExecutionPolicy &snp,
+                   cl::sycl::queue q,
+                   cl::sycl::buffer<A, 1> input_buff,
+                   B init, //map is not applied on init
+                   sycl_algorithm_descriptor d,
+                   Map map,
+                   Reduce reduce) {
+  auto result_buff =
+    impl::buffer_mapreduce_device(snp, q, input_buff, init, d, map, reduce);
+  auto read_result = result_buff.template get_access
+    <cl::sycl::access::mode::read>();
+  return read_result[0];
 }
 
 /*
@@ -239,6 +365,8 @@ B buffer_mapreduce(ExecutionPolicy &snp,
  * Map : A1 -> A2 -> B
  * Reduce : B -> B -> B
  *
+ * The result is left on the device, in a one-element buffer: the host only
+ * waits for it when it reads it.
  */
 template <typename ExecutionPolicy,
           typename A1,
@@ -246,14 +374,14 @@ template <typename ExecutionPolicy,
           typename B,
           typename Reduce,
           typename Map>
-B buffer_map2reduce(ExecutionPolicy &snp,
-                    cl::sycl::queue q,
-                    cl::sycl::buffer<A1, 1> input_buff1,
-                    cl::sycl::buffer<A2, 1> input_buff2,
-                    B init, //map is not applied on init
-                    sycl_algorithm_descriptor d,
-                    Map map,
-                    Reduce reduce) {
+cl::sycl::buffer<B, 1> buffer_map2reduce_device(ExecutionPolicy &snp,
+                                                cl::sycl::queue q,
+                                                cl::sycl::buffer<A1, 1> input_buff1,
+                                                cl::sycl::buffer<A2, 1> input_buff2,
+                                                B init, //map is not applied on init
+                                                sycl_algorithm_descriptor d,
+                                                Map map,
+                                                Reduce reduce) {
 
   if ((d.nb_work_item == 0) || (d.nb_work_group == 0)) {
     auto read_input1 = input_buff1.template get_access
@@ -264,13 +392,13 @@ B buffer_map2reduce(ExecutionPolicy &snp,
     for (size_t pos = 0; pos < d.size; pos++)
       acc = reduce(acc, map(pos, read_input1[pos], read_input2[pos]));
 
-    return acc;
+    return make_result_buffer(acc);
   }
 
   using std::min;
   using std::max;
 
-  cl::sycl::buffer<B, 1> output_buff { cl::sycl::range<1> { d.nb_work_group } };
+  auto output_buff = sycl::helpers::make_temp_buffer<B>(d.nb_work_group);
 
   q.submit([&] (cl::sycl::handler &cgh) {
     cl::sycl::nd_range<1> rng
@@ -302,7 +430,7 @@ B buffer_map2reduce(ExecutionPolicy &snp,
           for (size_t read = local_pos + d.nb_work_item;
                read < group_end;
                read += d.nb_work_item) {
-            acc = reduce(acc, map(read, input1[read], input2[local_pos]));
+            acc = reduce(acc, map(read, input1[read], input2[read]));
           }
           sum[local_id] = acc;
         }
@@ -316,38 +444,56 @@ B buffer_map2reduce(ExecutionPolicy &snp,
       output[group_id] = acc;
     });
   });
-  auto read_output  = output_buff.template get_access
-    <cl::sycl::access::mode::read>();
 
-  B acc = init;
-  for (size_t pos0 = 0; pos0 < d.nb_work_group; pos0++)
-    acc = reduce(acc, read_output[pos0]);
+  return buffer_combine<cl::sycl::helpers::NameGen<3,
+                          typename ExecutionPolicy::kernelName, B>>(
+      q, output_buff, d.nb_work_group, init, reduce);
+}
 
-  return acc;
+/*
+ * Map2Reduce on a buffer
+ *
+ * Same as buffer_map2reduce_device, returning the result to the host
+ */
+template <typename ExecutionPolicy,
+          typename A1,
+          typename A2,
+          typename B,
+          typename Reduce,
+          typename Map>
+B buffer_map2reduce(ExecutionPolicy &snp,
+                    cl::sycl::queue q,
+                    cl::sycl::buffer<A1, 1> input_buff1,
+                    cl::sycl::buffer<A2, 1> input_buff2,
+                    B init, //map is not applied on init
+                    sycl_algorithm_descriptor d,
+                    Map map,
+                    Reduce reduce) {
+  auto result_buff = buffer_map2reduce_device(snp, q, input_buff1, input_buff2,
+                                              init, d, map, reduce);
+  auto read_result = result_buff.template get_access
+    <cl::sycl::access::mode::read>();
+  return read_result[0];
 }
 
 
 
-sycl_algorithm_descriptor compute_mapscan_descriptor(cl::sycl::device device,
-                                              size_t size,
-                                              size_t sizeofB) {
+sycl_algorithm_descriptor compute_mapscan_descriptor(
+    const sycl::helpers::device_info &device,
+    size_t size,
+    size_t sizeofB) {
   using std::min;
   using std::max;
   if (size == 0)
     return sycl_algorithm_descriptor {};
-  size_t local_mem_size =
-    device.get_info<cl::sycl::info::device::local_mem_size>();
+  size_t local_mem_size = device.local_mem_size;
   size_t size_per_work_group = min(size, local_mem_size / sizeofB);
   if (size_per_work_group <= 0)
     return sycl_algorithm_descriptor { size };
 
   size_t nb_work_group = up_rounded_division(size, size_per_work_group);
 
-  const cl::sycl::id<3> max_work_item_sizes =
-    device.get_info<cl::sycl::info::device::max_work_item_sizes>();
-  const auto max_work_item = min(
-    device.get_info<cl::sycl::info::device::max_work_group_size>(),
-    max_work_item_sizes[0]);
+  const auto max_work_item = device.max_work_group_size;
   size_t nb_work_item = min(max_work_item, size_per_work_group);
   size_t size_per_work_item =
     up_rounded_division(size_per_work_group, nb_work_item);
@@ -359,24 +505,73 @@ sycl_algorithm_descriptor compute_mapscan_descriptor(cl::sycl::device device,
     nb_work_item };
 }
 
+/*
+ * Same as above, with the capabilities of the device read from the cache
+ * and the descriptor memoised
+ */
+inline sycl_algorithm_descriptor compute_mapscan_descriptor(
+    cl::sycl::device device,
+    size_t size,
+    size_t sizeofB) {
+  auto info = sycl::helpers::get_device_info(device);
+  return memoise_descriptor(
+      descriptor_key { info.key, descriptor_mapscan, size, sizeofB },
+      [&]() { return compute_mapscan_descriptor(info, size, sizeofB); });
+}
+
 
-template <class ExecutionPolicy, class A, class B, class Reduce, class Map>
-void buffer_mapscan(ExecutionPolicy &snp,
-                    cl::sycl::queue q,
-                    cl::sycl::buffer<A, 1> input_buffer,
-                    cl::sycl::buffer<B, 1> output_buffer,
-                    B init,
-                    sycl_algorithm_descriptor d,
-                    Map map,
-                    Reduce red) {
+/*
+ * Identity map, used to scan the totals of the work-groups
+ */
+template <typename T>
+struct scan_identity {
+  T operator()(T x) const { return x; }
+};
+
+/*
+ * Descriptor of the scan of the totals of the work-groups of d but the last
+ * one, split in tiles no larger than those of d (d has several work-groups)
+ */
+inline sycl_algorithm_descriptor mapscan_totals_descriptor(
+    sycl_algorithm_descriptor d) {
+  using std::min;
+  size_t size = d.nb_work_group - 1;
+  size_t size_per_work_group = min(size, d.size_per_work_group);
+  size_t nb_work_item = min(d.nb_work_item, size_per_work_group);
+  return sycl_algorithm_descriptor {
+    size,
+    size_per_work_group,
+    up_rounded_division(size_per_work_group, nb_work_item),
+    up_rounded_division(size, size_per_work_group),
+    nb_work_item };
+}
+
+/*
+ * One level of buffer_mapscan
+ *
+ * The totals of the work-groups are scanned on the device by a recursive
+ * call, named TotalsKernelName at every level below the first one, so only
+ * nb_work_group values move between two levels. The levels below reuse the
+ * tiles of d, as the totals have the same type B.
+ */
+template <class KernelName, class TotalsKernelName,
+          class A, class B, class Reduce, class Map>
+void buffer_mapscan_level(cl::sycl::queue q,
+                          cl::sycl::buffer<A, 1> input_buffer,
+                          cl::sycl::buffer<B, 1> output_buffer,
+                          B init,
+                          sycl_algorithm_descriptor d,
+                          Map map,
+                          Reduce red) {
     //map is not applied on init
 
   using std::min;
   using std::max;
 
-  //WARNING: nb_work_group is not bounded by max_compute_units
-  auto scan = sycl::helpers::make_temp_buffer<B>( d.nb_work_group );
-  //cl::sycl::buffer<B, 1> scan = { cl::sycl::range<1> { d.nb_work_group } };
+  // scan[g] holds init combined with the totals of the work-groups 0 to g
+  size_t nb_total = d.nb_work_group - 1;
+  auto scan = sycl::helpers::make_temp_buffer<B>(max(nb_total,
+                                                     static_cast<size_t>(1)));
   cl::sycl::range<1> rng_wg {d.nb_work_group * d.nb_work_item};
   cl::sycl::range<1> rng_wi {d.nb_work_item};
 
@@ -391,7 +586,7 @@ void buffer_mapscan(ExecutionPolicy &snp,
       scratch { cl::sycl::range<1> { d.size_per_work_group }, cgh };
 
 
-    cgh.parallel_for_work_group<cl::sycl::helpers::NameGen<0, typename ExecutionPolicy::kernelName> >(rng_wg, rng_wi,
+    cgh.parallel_for_work_group<cl::sycl::helpers::NameGen<0, KernelName> >(rng_wg, rng_wi,
                                           [=](cl::sycl::group<1> grp) {
       size_t group_id = grp.get_id(0);
       size_t group_begin = group_id * d.size_per_work_group;
@@ -476,19 +671,22 @@ void buffer_mapscan(ExecutionPolicy &snp,
   });
 
   // STEP II: global scan
-  {
-    auto buff  = output_buffer.template get_access
-      <cl::sycl::access::mode::read_write>();
-    auto write_scan  = scan.template get_access
-      <cl::sycl::access::mode::write>();
-    B acc = init;
-    for (size_t global_pos = d.size_per_work_group - 1, local_pos = 0;
-        local_pos < d.nb_work_group - 1;
-        local_pos++, global_pos += d.size_per_work_group) {
-      write_scan[local_pos] = acc;
-      acc = red(acc, buff[global_pos]);
-    }
-    write_scan[d.nb_work_group - 1] = acc;
+  // gather the total of every work-group but the last one and scan them
+  // on the device
+  if (nb_total > 0) {
+    q.submit([&] (cl::sycl::handler &cgh) {
+      auto buff = output_buffer.template get_access
+        <cl::sycl::access::mode::read>(cgh);
+      auto write_scan = scan.template get_access
+        <cl::sycl::access::mode::write>(cgh);
+      cgh.parallel_for<cl::sycl::helpers::NameGen<3, KernelName>>(
+          cl::sycl::range<1> { nb_total }, [=](cl::sycl::id<1> id) {
+        write_scan[id] = buff[(id[0] + 1) * d.size_per_work_group - 1];
+      });
+    });
+    auto d_total = mapscan_totals_descriptor(d);
+    buffer_mapscan_level<TotalsKernelName, TotalsKernelName>(
+        q, scan, scan, init, d_total, scan_identity<B>(), red);
   }
 
 
@@ -498,10 +696,10 @@ void buffer_mapscan(ExecutionPolicy &snp,
       <cl::sycl::access::mode::read_write>(cgh);
     auto read_scan = scan.template get_access
       <cl::sycl::access::mode::read>(cgh);
-    cgh.parallel_for_work_group<cl::sycl::helpers::NameGen<1, typename ExecutionPolicy::kernelName>>(rng_wg, rng_wi,
+    cgh.parallel_for_work_group<cl::sycl::helpers::NameGen<1, KernelName>>(rng_wg, rng_wi,
                                           [=](cl::sycl::group<1> grp) {
       size_t group_id = grp.get_id(0);
-      B acc = read_scan[group_id];
+      B acc = (group_id == 0) ? init : read_scan[group_id - 1];
       //assert(group_id < d.nb_work_group);
       size_t group_begin = group_id * d.size_per_work_group;
       size_t group_end   = min((group_id+1) * d.size_per_work_group, d.size);
@@ -525,6 +723,238 @@ void buffer_mapscan(ExecutionPolicy &snp,
   return;
 }
 
+/*
+ * MapScan on a buffer
+ *
+ * with map/reduce functions typed as follow
+ * Map    : A -> B
+ * Reduce : B -> B -> B
+ */
+template <class ExecutionPolicy, class A, class B, class Reduce, class Map>
+void buffer_mapscan(ExecutionPolicy &snp,
+                    cl::sycl::queue q,
+                    cl::sycl::buffer<A, 1> input_buffer,
+                    cl::sycl::buffer<B, 1> output_buffer,
+                    B init,
+                    sycl_algorithm_descriptor d,
+                    Map map,
+                    Reduce red) {
+  typedef typename ExecutionPolicy::kernelName kernelName;
+  buffer_mapscan_level<kernelName, cl::sycl::helpers::NameGen<4, kernelName>>(
+      q, input_buffer, output_buffer, init, d, map, red);
+}
+
+/*
+ * Status of a tile in buffer_mapscan_single_pass: a tile first publishes
+ * its aggregate, then its inclusive prefix once the look-back is done
+ */
+enum scan_tile_status {
+  scan_tile_invalid = 0,
+  scan_tile_aggregate = 1,
+  scan_tile_prefix = 2
+};
+
+/*
+ * Sets the tile status and the tile counter of buffer_mapscan_single_pass
+ * to 0 with a kernel, so the scan never waits on the host
+ */
+template <class KernelName>
+void zero_scan_tile_status(cl::sycl::queue q,
+                           cl::sycl::buffer<int, 1> &status,
+                           cl::sycl::buffer<int, 1> &counter) {
+  q.submit([&](cl::sycl::handler &cgh) {
+    auto aS = status.template get_access<cl::sycl::access::mode::write>(cgh);
+    auto aC = counter.template get_access<cl::sycl::access::mode::write>(cgh);
+    cgh.parallel_for<KernelName>(
+        cl::sycl::range<1>{status.get_count()}, [aS, aC](cl::sycl::id<1> id) {
+          aS[id] = scan_tile_invalid;
+          if (id[0] == 0) {
+            aC[0] = 0;
+          }
+        });
+  });
+}
+
+/*
+ * Single-pass MapScan on a buffer
+ *
+ * with map/reduce functions typed as follow
+ * Map    : A -> B
+ * Reduce : B -> B -> B
+ *
+ * Each work-group scans a tile in local memory as buffer_mapscan does, then
+ * publishes the aggregate of the tile and looks back at the previous tiles
+ * until it finds one whose inclusive prefix is known (decoupled look-back).
+ * Tiles are numbered in the order the work-groups start, so a work-group
+ * only waits for work-groups that are already running.
+ * Every element is read and written once in global memory, and the host is
+ * not involved during the scan.
+ * When exclusive is true, output[i] does not include input[i].
+ * When has_init is false, init is ignored and the inclusive scan starts
+ * from the mapped first element, so no identity of red is needed.
+ */
+template <class ExecutionPolicy, class A, class B, class Reduce, class Map>
+void buffer_mapscan_single_pass(ExecutionPolicy &snp,
+                                cl::sycl::queue q,
+                                cl::sycl::buffer<A, 1> input_buffer,
+                                cl::sycl::buffer<B, 1> output_buffer,
+                                B init,
+                                sycl_algorithm_descriptor d,
+                                Map map,
+                                Reduce red,
+                                bool exclusive,
+                                bool has_init = true) {
+    //map is not applied on init
+
+  using std::min;
+
+  auto status = sycl::helpers::make_temp_buffer<int>(d.nb_work_group);
+  auto counter = sycl::helpers::make_temp_buffer<int>(1);
+  zero_scan_tile_status<cl::sycl::helpers::NameGen<
+      2, typename ExecutionPolicy::kernelName, scan_tile_status>>(
+      q, status, counter);
+  auto aggregate = sycl::helpers::make_temp_buffer<B>(d.nb_work_group);
+  auto prefix = sycl::helpers::make_temp_buffer<B>(d.nb_work_group);
+  cl::sycl::range<1> rng_wg {d.nb_work_group * d.nb_work_item};
+  cl::sycl::range<1> rng_wi {d.nb_work_item};
+
+  q.submit([&] (cl::sycl::handler &cgh) {
+    auto input =
+      input_buffer.template get_access<cl::sycl::access::mode::read>(cgh);
+    auto output =
+      output_buffer.template get_access<cl::sycl::access::mode::write>(cgh);
+    auto tile_status =
+      status.template get_access<cl::sycl::access::mode::atomic>(cgh);
+    auto tile_counter =
+      counter.template get_access<cl::sycl::access::mode::atomic>(cgh);
+    auto tile_aggregate =
+      aggregate.template get_access<cl::sycl::access::mode::read_write>(cgh);
+    auto tile_prefix =
+      prefix.template get_access<cl::sycl::access::mode::read_write>(cgh);
+
+    cl::sycl::accessor<B, 1, cl::sycl::access::mode::read_write,
+                       cl::sycl::access::target::local>
+      scratch { cl::sycl::range<1> { d.size_per_work_group }, cgh };
+
+    cgh.parallel_for_work_group<cl::sycl::helpers::NameGen<2, typename ExecutionPolicy::kernelName> >(rng_wg, rng_wi,
+                                          [=](cl::sycl::group<1> grp) {
+      size_t tile = cl::sycl::atomic_fetch_add(tile_counter[0], 1);
+      size_t group_begin = tile * d.size_per_work_group;
+      size_t group_end   = min((tile+1) * d.size_per_work_group, d.size);
+      size_t local_size = group_end - group_begin;
+
+      // Step 0:
+      // each work_item copy a piece of data
+      // map is applied during the process
+      grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+        size_t local_id  = id.get_local_id(0);
+        for (size_t gpos = group_begin + local_id, lpos = local_id;
+            gpos < group_end;
+            gpos += d.nb_work_item, lpos += d.nb_work_item) {
+          scratch[lpos] = map(input[gpos]);
+        }
+      });
+
+      // Step 1:
+      // each work_item scan a piece of data
+      grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+        size_t local_id  = id.get_local_id(0);
+        size_t local_pos = local_id * d.size_per_work_item;
+        size_t local_end = min((local_id+1) * d.size_per_work_item, local_size);
+        if (local_pos < local_end) {
+          B acc = scratch[local_pos];
+          local_pos++;
+          for (; local_pos < local_end; local_pos++) {
+            acc = red(acc, scratch[local_pos]);
+            scratch[local_pos] = acc;
+          }
+        }
+      });
+
+      // Step 2:
+      {
+        // scan on every last item
+        size_t local_pos = d.size_per_work_item - 1;
+        if (local_pos < local_size)
+        {
+          B acc = scratch[local_pos];
+          local_pos += d.size_per_work_item;
+          for (; local_pos < local_size; local_pos += d.size_per_work_item) {
+            acc = red(acc, scratch[local_pos]);
+            scratch[local_pos] = acc;
+          }
+        }
+      }
+
+      // Step 3:
+      // (except for item = 0) add the last element of the previous block
+      grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+        size_t local_id  = id.get_local_id(0);
+        if (local_id > 0) {
+          size_t local_pos = local_id * d.size_per_work_item;
+          size_t local_end = min((local_id+1) * d.size_per_work_item - 1,
+                                 local_size);
+          if (local_pos < local_end) {
+            B acc = scratch[local_pos - 1];
+            for (; local_pos < local_end; local_pos++) {
+              scratch[local_pos] = red(acc, scratch[local_pos]);
+            }
+          }
+        }
+      });
+
+      // Step 4:
+      // look back at the previous tiles to find the prefix of this one
+      // the first tile has no prefix when there is no initial value
+      B acc = init;
+      bool has_acc = has_init || tile > 0;
+      B tile_sum = scratch[local_size - 1];
+      if (tile > 0) {
+        tile_aggregate[tile] = tile_sum;
+        grp.mem_fence(cl::sycl::access::fence_space::global_space);
+        tile_status[tile].store(scan_tile_aggregate);
+
+        // tile 0 always publishes its prefix, so the look-back stops there
+        size_t look = tile;
+        bool found = false;
+        while (!found) {
+          look--;
+          int look_status;
+          do {
+            look_status = tile_status[look].load();
+          } while (look_status == scan_tile_invalid);
+          // the status load is relaxed: order it before the value loads
+          grp.mem_fence(cl::sycl::access::fence_space::global_space);
+          found = (look_status == scan_tile_prefix);
+          B look_value = found ? tile_prefix[look] : tile_aggregate[look];
+          acc = (look == tile - 1) ? look_value : red(look_value, acc);
+        }
+      }
+      tile_prefix[tile] = has_acc ? red(acc, tile_sum) : tile_sum;
+      grp.mem_fence(cl::sycl::access::fence_space::global_space);
+      tile_status[tile].store(scan_tile_prefix);
+
+      // Step 5:
+      // each work_item copy a piece of data, adding the prefix of the tile
+      grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+        size_t local_id = id.get_local_id(0);
+        for (size_t gpos = group_begin + local_id, lpos = local_id;
+            gpos < group_end;
+            gpos += d.nb_work_item, lpos += d.nb_work_item) {
+          if (!has_acc)
+            output[gpos] = scratch[lpos];
+          else if (!exclusive)
+            output[gpos] = red(acc, scratch[lpos]);
+          else if (lpos == 0)
+            output[gpos] = acc;
+          else
+            output[gpos] = red(acc, scratch[lpos - 1]);
+        }
+      });
+    });
+  });
+}
+
 template <class BaseKernelName, class InT1, class InT2, class OutT, class IndexT,
           class BinaryOperation1, class BinaryOperation2>
 OutT inner_product_sequential_sycl(cl::sycl::queue q, cl::sycl::buffer<InT1, 1> input_buff1,
@@ -0,0 +1,253 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_COPY_IF__
+#define __SYCL_IMPL_ALGORITHM_COPY_IF__
+
+#include <type_traits>
+#include <iterator>
+#include <utility>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+/** compact_name.
+ * Class used to name the stream compaction kernels per type.
+ */
+template <typename T>
+class compact_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+
+template <class KernelName>
+class sycl_execution_policy;
+
+namespace impl {
+
+/** compact_flag.
+ * Map of the compaction scan: 1 for the elements satisfying the predicate,
+ * 0 otherwise.
+ */
+template <typename T, class UnaryPredicate>
+struct compact_flag {
+  UnaryPredicate pred;
+
+  size_t operator()(const T &v) const { return pred(v) ? 1 : 0; }
+};
+
+/** compact_plus.
+ * Reduction of the compaction scan.
+ */
+struct compact_plus {
+  size_t operator()(size_t lhs, size_t rhs) const { return lhs + rhs; }
+};
+
+/* compact_scan.
+ * @brief Writes in positions the inclusive scan of the predicate flags of
+ * input, so the n-th selected element has n in positions, and returns the
+ * number of selected elements.
+ * The predicate is applied while the single-pass scan loads its tiles, so
+ * the flags are never stored.
+ */
+template <class KernelName, class T, class UnaryPredicate>
+size_t compact_scan(cl::sycl::queue q, cl::sycl::buffer<T, 1> input,
+                    cl::sycl::buffer<size_t, 1> positions, size_t size,
+                    UnaryPredicate pred) {
+  auto d = compute_mapscan_descriptor(q.get_device(), size, sizeof(size_t));
+  sycl_execution_policy<KernelName> ssep(q);
+  impl::buffer_mapscan_single_pass(ssep, q, input, positions, size_t(0), d,
+                                   compact_flag<T, UnaryPredicate>{pred},
+                                   compact_plus(), false);
+  auto hP = positions.template get_access<cl::sycl::access::mode::read>();
+  return hP[size - 1];
+}
+
+/* compact_scatter.
+ * @brief Copies to output the elements of input for which pred returns
+ * Keep, at the position given by the scan of compact_scan.
+ */
+template <class KernelName, bool Keep, class T, class U,
+          class UnaryPredicate>
+void compact_scatter(cl::sycl::queue q, cl::sycl::buffer<T, 1> input,
+                     cl::sycl::buffer<size_t, 1> positions,
+                     cl::sycl::buffer<U, 1> output, size_t size,
+                     UnaryPredicate pred) {
+  q.submit([&](cl::sycl::handler &h) {
+    auto aI = input.template get_access<cl::sycl::access::mode::read>(h);
+    auto aP = positions.template get_access<cl::sycl::access::mode::read>(h);
+    auto aO = output.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<KernelName>(
+        cl::sycl::range<1>{size}, [aI, aP, aO, pred](cl::sycl::id<1> id) {
+          size_t pos = id[0];
+          T v = aI[pos];
+          if (static_cast<bool>(pred(v)) == Keep) {
+            // aP[pos] selected elements up to pos, the others were rejected
+            aO[Keep ? aP[pos] - 1 : pos - aP[pos]] = v;
+          }
+        });
+  });
+}
+
+/* compact.
+ * @brief Copies the elements of [first, last) for which pred returns Keep to
+ * the range beginning at result, preserving their order.
+ * The flags of the predicate are scanned in a single pass, then every
+ * selected element is scattered to its position. Only the number of
+ * selected elements is read back on the host, to size the output.
+ * @param sep    : Execution Policy
+ * @param first  : Start of the range
+ * @param last   : End of the range
+ * @param result : Start of the output range
+ * @param pred   : Unary predicate
+ * When InPlace is true, result is first: if the input buffer is shared with
+ * the output one, the elements are scattered from a copy of the input.
+ * @return  The end of the output range
+ */
+template <bool Keep, bool InPlace = false, class ExecutionPolicy,
+          class InputIt, class OutputIt, class UnaryPredicate>
+OutputIt compact(ExecutionPolicy &sep, InputIt first, InputIt last,
+                 OutputIt result, UnaryPredicate pred) {
+  typedef typename std::iterator_traits<InputIt>::value_type value_type;
+  typedef compact_name<typename ExecutionPolicy::kernelName> kernelName;
+  typedef std::integral_constant<bool, Keep> keep_type;
+  using ScanName = cl::sycl::helpers::NameGen<0, kernelName, value_type>;
+  using ScatterName =
+      cl::sycl::helpers::NameGen<1, kernelName, value_type, keep_type>;
+  using CopyName = cl::sycl::helpers::NameGen<4, kernelName, value_type>;
+
+  cl::sycl::queue q(sep.get_queue());
+  size_t size = sycl::helpers::distance(first, last);
+  if (size < 1) {
+    return result;
+  }
+  auto input = sycl::helpers::make_const_buffer(first, last);
+  auto positions = sycl::helpers::make_temp_buffer<size_t>(size);
+  size_t count = compact_scan<ScanName>(q, input, positions, size, pred);
+  if (!Keep) {
+    count = size - count;
+  }
+  if (count < 1) {
+    return result;
+  }
+  auto result_last = std::next(result, count);
+  {
+    auto output = sycl::helpers::make_buffer(result, result_last);
+    if (InPlace && sycl::helpers::is_shared_range(first, last)) {
+      auto copy =
+          sycl::helpers::copy_to_temp_buffer<CopyName>(q, input, size);
+      compact_scatter<ScatterName, Keep>(q, copy, positions, output, size,
+                                         pred);
+    } else {
+      compact_scatter<ScatterName, Keep>(q, input, positions, output, size,
+                                         pred);
+    }
+  }
+  return result_last;
+}
+
+/* copy_if.
+ * @brief Copies the elements of [first, last) for which pred returns true.
+ */
+template <class ExecutionPolicy, class InputIt, class OutputIt,
+          class UnaryPredicate>
+OutputIt copy_if(ExecutionPolicy &sep, InputIt first, InputIt last,
+                 OutputIt result, UnaryPredicate pred) {
+  return impl::compact<true>(sep, first, last, result, pred);
+}
+
+/* remove_copy_if.
+ * @brief Copies the elements of [first, last) for which pred returns false.
+ */
+template <class ExecutionPolicy, class InputIt, class OutputIt,
+          class UnaryPredicate>
+OutputIt remove_copy_if(ExecutionPolicy &sep, InputIt first, InputIt last,
+                        OutputIt result, UnaryPredicate pred) {
+  return impl::compact<false>(sep, first, last, result, pred);
+}
+
+/* remove_if.
+ * @brief Moves the elements of [first, last) for which pred returns false to
+ * the beginning of the range. The input is read from its own buffer, or
+ * from a copy when its buffer is shared, so the compaction can write over
+ * it.
+ */
+template <class ExecutionPolicy, class ForwardIt, class UnaryPredicate>
+ForwardIt remove_if(ExecutionPolicy &sep, ForwardIt first, ForwardIt last,
+                    UnaryPredicate pred) {
+  return impl::compact<false, true>(sep, first, last, first, pred);
+}
+
+/* partition_copy.
+ * @brief Copies the elements of [first, last) for which pred returns true to
+ * the range beginning at out_true, and the others to the range beginning at
+ * out_false. Both outputs are scattered from a single scan.
+ * @return  The ends of both output ranges
+ */
+template <class ExecutionPolicy, class InputIt, class OutputIt1,
+          class OutputIt2, class UnaryPredicate>
+std::pair<OutputIt1, OutputIt2> partition_copy(ExecutionPolicy &sep,
+                                               InputIt first, InputIt last,
+                                               OutputIt1 out_true,
+                                               OutputIt2 out_false,
+                                               UnaryPredicate pred) {
+  typedef typename std::iterator_traits<InputIt>::value_type value_type;
+  typedef compact_name<typename ExecutionPolicy::kernelName> kernelName;
+  using ScanName = cl::sycl::helpers::NameGen<0, kernelName, value_type>;
+  using TrueName = cl::sycl::helpers::NameGen<2, kernelName, value_type>;
+  using FalseName = cl::sycl::helpers::NameGen<3, kernelName, value_type>;
+
+  cl::sycl::queue q(sep.get_queue());
+  size_t size = sycl::helpers::distance(first, last);
+  if (size < 1) {
+    return std::make_pair(out_true, out_false);
+  }
+  auto input = sycl::helpers::make_const_buffer(first, last);
+  auto positions = sycl::helpers::make_temp_buffer<size_t>(size);
+  size_t count = compact_scan<ScanName>(q, input, positions, size, pred);
+  auto true_last = std::next(out_true, count);
+  auto false_last = std::next(out_false, size - count);
+  if (count > 0) {
+    auto output = sycl::helpers::make_buffer(out_true, true_last);
+    compact_scatter<TrueName, true>(q, input, positions, output, size, pred);
+  }
+  if (count < size) {
+    auto output = sycl::helpers::make_buffer(out_false, false_last);
+    compact_scatter<FalseName, false>(q, input, positions, output, size,
+                                      pred);
+  }
+  return std::make_pair(true_last, false_last);
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_COPY_IF__
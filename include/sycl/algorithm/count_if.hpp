@@ -64,7 +64,7 @@ typename std::iterator_traits<InputIterator>::difference_type count_if(
 
   auto device = q.get_device();
   auto bufI = sycl::helpers::make_const_buffer(first, last);
-  cl::sycl::buffer<int, 1> bufR((cl::sycl::range<1>(vectorSize)));
+  auto bufR = sycl::helpers::make_temp_buffer<int>(vectorSize);
   auto length = vectorSize;
   auto ndRange = exec.calculateNdRange(vectorSize);
   const auto local = ndRange.get_local_range()[0];
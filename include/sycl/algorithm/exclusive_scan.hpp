@@ -47,14 +47,18 @@ template <class ExecutionPolicy, class InputIterator, class OutputIterator,
 OutputIterator exclusive_scan(ExecutionPolicy &sep, InputIterator b,
                               InputIterator e, OutputIterator o, ElemT init,
                               BinaryOperation bop) {
+  typedef typename std::iterator_traits<OutputIterator>::value_type type_;
   auto q = sep.get_queue();
-  auto device = q.get_device();
-
+  if (b == e) {
+    return o;
+  }
+  // the input is only read: it may be a buffer shared with other calls
   auto bufI = sycl::helpers::make_const_buffer(b, e);
 
   auto vectorSize = bufI.get_count();
-  // declare a temporary "swap" buffer
   auto bufO = sycl::helpers::make_buffer(o, o + vectorSize);
+  // declare a temporary "swap" buffer
+  auto bufT = sycl::helpers::make_temp_buffer<type_>(vectorSize);
 
   const auto ndRange = sep.calculateNdRange(vectorSize);
   // calculate iteration count, with extra if not a power of two size buffer
@@ -65,43 +69,40 @@ OutputIterator exclusive_scan(ExecutionPolicy &sep, InputIterator b,
   if ((vectorSize & (vectorSize - 1)) != 0) {
     iterations++;
   }
-  // calculate the buffer to read from first, so we always finally write to bufO
-  auto inBuf = &bufI;
-  auto outBuf = &bufO;
+  // calculate the buffer to write first, so we always finally write to bufO
+  cl::sycl::buffer<type_, 1> *inBuf = &bufT;
+  cl::sycl::buffer<type_, 1> *outBuf = &bufO;
   if (iterations % 2 != 0) {
-    outBuf = &bufI;
-    inBuf = &bufO;
+    std::swap(inBuf, outBuf);
   }
   // do a parallel shift right, and set the first element to the initial value.
   // this works, as an exclusive scan is equivalent to a shift
   // (with initial set at element 0) followed by an inclusive scan
-  auto shr = [vectorSize, ndRange, inBuf, outBuf, init](
+  auto shr = [&bufI, vectorSize, ndRange, outBuf, init](
       cl::sycl::handler &h) {
-    auto aI = inBuf->template get_access<cl::sycl::access::mode::read>(h);
+    auto aI = bufI.template get_access<cl::sycl::access::mode::read>(h);
     auto aO = outBuf->template get_access<cl::sycl::access::mode::write>(h);
     h.parallel_for<
         cl::sycl::helpers::NameGen<0, typename ExecutionPolicy::kernelName> >(
         ndRange, [aI, aO, init, vectorSize](cl::sycl::nd_item<1> id) {
           size_t m_id = id.get_global_id(0);
-          if (m_id > 0) {
+          if (m_id > 0 && m_id < vectorSize) {
             aO[m_id] = aI[m_id - 1];
-          } else {
+          } else if (m_id == 0) {
             aO[m_id] = init;
           }
         });
   };
   q.submit(shr);
-  // swap the buffers so we read from the buffer with the shifted contents
-  std::swap(inBuf, outBuf);
   // perform an inclusive scan on the shifted array
-  int i = 1;
-  do {
+  for (int i = 1; i <= iterations; i++) {
+    // swap the buffers so we read from the last written one
+    std::swap(inBuf, outBuf);
     auto f = [vectorSize, i, ndRange, inBuf, outBuf, bop](
         cl::sycl::handler &h) {
-      auto aI =
-          inBuf->template get_access<cl::sycl::access::mode::read_write>(h);
+      auto aI = inBuf->template get_access<cl::sycl::access::mode::read>(h);
       auto aO =
-          outBuf->template get_access<cl::sycl::access::mode::read_write>(h);
+          outBuf->template get_access<cl::sycl::access::mode::write>(h);
       h.parallel_for<
           cl::sycl::helpers::NameGen<1, typename ExecutionPolicy::kernelName> >(
           ndRange, [aI, aO, bop, vectorSize, i](cl::sycl::nd_item<1> id) {
@@ -109,16 +110,13 @@ OutputIterator exclusive_scan(ExecutionPolicy &sep, InputIterator b,
             size_t m_id = id.get_global_id(0);
             if (m_id < vectorSize && m_id >= td) {
               aO[m_id] = bop(aI[m_id - td], aI[m_id]);
-            } else {
+            } else if (m_id < vectorSize) {
               aO[m_id] = aI[m_id];
             }
           });
     };
     q.submit(f);
-    // swap the buffers between iterations
-    std::swap(inBuf, outBuf);
-    i++;
-  } while (i <= iterations);
+  }
   q.wait_and_throw();
   return o + vectorSize;
 }
@@ -137,36 +135,33 @@ OutputIterator exclusive_scan(ExecutionPolicy &snp, InputIterator b,
 
   cl::sycl::queue q(snp.get_queue());
   auto device = q.get_device();
-  auto size = sycl::helpers::distance(b, e);
+  size_t size = sycl::helpers::distance(b, e);
   using value_type = typename std::iterator_traits<InputIterator>::value_type;
-#ifdef TRISYCL_CL_LANGUAGE_VERSION
-  std::vector<value_type> vect { b, e };
-  *o++ = init;
-#endif
-
-
+  if (size == 0) {
+    return o;
+  }
   {
 #ifdef TRISYCL_CL_LANGUAGE_VERSION
-    cl::sycl::buffer<value_type, 1> buffer { vect.data(), size - 1 };
+    cl::sycl::buffer<value_type, 1> buffer { b, e };
     buffer.set_final_data(o);
 #else
-    std::shared_ptr<value_type> data { new value_type[size-1],
+    std::shared_ptr<value_type> data { new value_type[size],
       [&](value_type* ptr) {
-        *o++ = init;
-        std::copy_n(ptr, size-1, o);
+        std::copy_n(ptr, size, o);
       }
     };
-    std::copy_n(b, size-1, data.get());
-    cl::sycl::buffer<value_type, 1> buffer { data, cl::sycl::range<1>{size-1} };
+    std::copy_n(b, size, data.get());
+    cl::sycl::buffer<value_type, 1> buffer { data, cl::sycl::range<1>{ size } };
 #endif
 
-    auto d = compute_mapscan_descriptor(device, size - 1, sizeof(value_type));
-    buffer_mapscan(snp, q, buffer, buffer, init, d,
-                   [](value_type x) { return x; },
-                   bop);
+    auto d = compute_mapscan_descriptor(device, size, sizeof(value_type));
+    buffer_mapscan_single_pass(snp, q, buffer, buffer,
+                               static_cast<value_type>(init), d,
+                               [](value_type x) { return x; },
+                               bop, true);
   }
 
-  return std::next(o, size - 1);
+  return std::next(o, size);
 }
 
 #endif
@@ -39,15 +39,12 @@
 namespace sycl {
 namespace impl {
 
-/* fill.
- * Implementation of the command group that submits a fill kernel.
- * The kernel is implemented as a lambda.
+/* buffer_fill.
+ * Submits the fill kernel on the whole buffer and returns its event.
  */
-template <typename ExecutionPolicy, typename ForwardIt, typename T>
-void fill(ExecutionPolicy &sep, ForwardIt b, ForwardIt e, const T &value) {
-  cl::sycl::queue q { sep.get_queue() };
-  auto device = q.get_device();
-  auto bufI = helpers::make_buffer( b, e );
+template <typename ExecutionPolicy, typename Buffer, typename T>
+cl::sycl::event buffer_fill(ExecutionPolicy &sep, cl::sycl::queue &q,
+                            Buffer &bufI, const T &value) {
   // copy value into a local variable, as we cannot capture it by reference
   T val = value;
   auto vectorSize = bufI.get_count();
@@ -62,7 +59,18 @@ void fill(ExecutionPolicy &sep, ForwardIt b, ForwardIt e, const T &value) {
           }
         });
   };
-  q.submit(f);
+  return q.submit(f);
+}
+
+/* fill.
+ * Implementation of the command group that submits a fill kernel.
+ * The kernel is implemented as a lambda.
+ */
+template <typename ExecutionPolicy, typename ForwardIt, typename T>
+void fill(ExecutionPolicy &sep, ForwardIt b, ForwardIt e, const T &value) {
+  cl::sycl::queue q { sep.get_queue() };
+  auto bufI = helpers::make_buffer( b, e );
+  buffer_fill(sep, q, bufI, value);
 }
 
 }  // namespace impl
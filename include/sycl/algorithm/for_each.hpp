@@ -39,6 +39,27 @@
 namespace sycl {
 namespace impl {
 
+/* buffer_for_each.
+ * Submits the for_each kernel on the whole buffer and returns its event.
+ */
+template <class ExecutionPolicy, class Buffer, class UnaryFunction>
+cl::sycl::event buffer_for_each(ExecutionPolicy &sep, cl::sycl::queue &q,
+                                Buffer &bufI, UnaryFunction op) {
+  auto vectorSize = bufI.get_count();
+  const auto ndRange = sep.calculateNdRange(vectorSize);
+  auto f = [vectorSize, ndRange, &bufI, op](
+      cl::sycl::handler &h) mutable {
+    auto aI = bufI.template get_access<cl::sycl::access::mode::read_write>(h);
+    h.parallel_for<typename ExecutionPolicy::kernelName>(
+        ndRange, [aI, op, vectorSize](cl::sycl::nd_item<1> id) {
+          if (id.get_global_id(0) < vectorSize) {
+            op(aI[id.get_global_id(0)]);
+          }
+        });
+  };
+  return q.submit(f);
+}
+
 /* for_each.
  * Implementation of the command group that submits a for_each kernel.
  * The kernel is implemented as a lambda.
@@ -47,21 +68,8 @@ template <class ExecutionPolicy, class Iterator, class UnaryFunction>
 void for_each(ExecutionPolicy &sep, Iterator b, Iterator e, UnaryFunction op) {
   {
     cl::sycl::queue q(sep.get_queue());
-    auto device = q.get_device();
     auto bufI = sycl::helpers::make_buffer(b, e);
-    auto vectorSize = bufI.get_count();
-    const auto ndRange = sep.calculateNdRange(vectorSize);
-    auto f = [vectorSize, ndRange, &bufI, op](
-        cl::sycl::handler &h) mutable {
-      auto aI = bufI.template get_access<cl::sycl::access::mode::read_write>(h);
-      h.parallel_for<typename ExecutionPolicy::kernelName>(
-          ndRange, [aI, op, vectorSize](cl::sycl::nd_item<1> id) {
-            if (id.get_global_id(0) < vectorSize) {
-              op(aI[id.get_global_id(0)]);
-            }
-          });
-    };
-    q.submit(f);
+    buffer_for_each(sep, q, bufI, op);
   }
 }
 
@@ -0,0 +1,190 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_HISTOGRAM__
+#define __SYCL_IMPL_ALGORITHM_HISTOGRAM__
+
+#include <type_traits>
+#include <algorithm>
+#include <iterator>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_device_info.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+/** histogram_name.
+ * Class used to name the histogram kernels per type.
+ */
+template <typename T>
+class histogram_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+namespace impl {
+
+/* histogram.
+ * @brief Counts the elements of [first, last) that fall in each of the
+ * num_bins bins, and writes the counts to the range beginning at bins_out.
+ * The bin of an element is given by bin_fn; elements whose bin is not
+ * smaller than num_bins are not counted.
+ * When the bins fit in local memory, every work-group counts its part of
+ * the input in a private copy of the bins with local atomics and writes it
+ * to a row of partial bins, without touching global memory for each
+ * element. A last kernel sums the rows of every bin.
+ * Otherwise, the elements are counted with atomics in a single row of bins
+ * in global memory.
+ * @param sep      : Execution Policy
+ * @param first    : Start of the range
+ * @param last     : End of the range
+ * @param bins_out : Start of the output range of bins
+ * @param num_bins : Number of bins
+ * @param bin_fn   : Unary operator returning the bin of an element
+ * @return  The end of the output range of bins
+ */
+template <class ExecutionPolicy, class InputIt, class OutputIt,
+          class BinFunction>
+OutputIt histogram(ExecutionPolicy &sep, InputIt first, InputIt last,
+                   OutputIt bins_out, size_t num_bins, BinFunction bin_fn) {
+  typedef typename std::iterator_traits<InputIt>::value_type value_type;
+  typedef typename std::iterator_traits<OutputIt>::value_type count_type;
+  typedef unsigned int counter_type;
+  typedef histogram_name<typename ExecutionPolicy::kernelName> kernelName;
+  using LocalName = cl::sycl::helpers::NameGen<0, kernelName, value_type>;
+  using GlobalName = cl::sycl::helpers::NameGen<1, kernelName, value_type>;
+  using MergeName =
+      cl::sycl::helpers::NameGen<2, kernelName, value_type, count_type>;
+  using std::min;
+
+  auto bins_last = std::next(bins_out, num_bins);
+  if (num_bins < 1) {
+    return bins_last;
+  }
+  cl::sycl::queue q(sep.get_queue());
+  auto device = q.get_device();
+  size_t size = sycl::helpers::distance(first, last);
+
+  auto d = compute_mapreduce_descriptor(device, size, sizeof(counter_type));
+  size_t local_mem_size = sycl::helpers::get_device_info(device).local_mem_size;
+  bool privatise = (d.nb_work_item > 0) && (d.nb_work_group > 0) &&
+                   (num_bins * sizeof(counter_type) <= local_mem_size);
+  size_t nb_rows = privatise ? d.nb_work_group : 1;
+
+  auto partial =
+      sycl::helpers::make_temp_buffer<counter_type>(nb_rows * num_bins);
+  if (size > 0) {
+    auto input = sycl::helpers::make_const_buffer(first, last);
+    if (privatise) {
+      q.submit([&](cl::sycl::handler &cgh) {
+        cl::sycl::range<1> rg{d.nb_work_group * d.nb_work_item};
+        cl::sycl::range<1> ri{d.nb_work_item};
+        auto aI = input.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto aP =
+            partial.template get_access<cl::sycl::access::mode::write>(cgh);
+        cl::sycl::accessor<counter_type, 1, cl::sycl::access::mode::atomic,
+                           cl::sycl::access::target::local>
+            bins{cl::sycl::range<1>(num_bins), cgh};
+        cgh.parallel_for_work_group<LocalName>(
+            rg, ri, [=](cl::sycl::group<1> grp) {
+              size_t group_id = grp.get_id(0);
+              size_t group_begin = group_id * d.size_per_work_group;
+              size_t group_end =
+                  min((group_id + 1) * d.size_per_work_group, d.size);
+              grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+                for (size_t bin = id.get_local_id(0); bin < num_bins;
+                     bin += d.nb_work_item) {
+                  bins[bin].store(0);
+                }
+              });
+              grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+                for (size_t pos = group_begin + id.get_local_id(0);
+                     pos < group_end; pos += d.nb_work_item) {
+                  size_t bin = bin_fn(aI[pos]);
+                  if (bin < num_bins) {
+                    cl::sycl::atomic_fetch_add(bins[bin], counter_type(1));
+                  }
+                }
+              });
+              grp.parallel_for_work_item([&](cl::sycl::h_item<1> id) {
+                for (size_t bin = id.get_local_id(0); bin < num_bins;
+                     bin += d.nb_work_item) {
+                  aP[group_id * num_bins + bin] = bins[bin].load();
+                }
+              });
+            });
+      });
+    } else {
+      {
+        auto hP = partial.template get_access<cl::sycl::access::mode::write>();
+        for (size_t bin = 0; bin < num_bins; bin++)
+          hP[bin] = 0;
+      }
+      q.submit([&](cl::sycl::handler &cgh) {
+        auto aI = input.template get_access<cl::sycl::access::mode::read>(cgh);
+        auto aP =
+            partial.template get_access<cl::sycl::access::mode::atomic>(cgh);
+        cgh.parallel_for<GlobalName>(
+            cl::sycl::range<1>{size},
+            [aI, aP, num_bins, bin_fn](cl::sycl::id<1> id) {
+              size_t bin = bin_fn(aI[id[0]]);
+              if (bin < num_bins) {
+                cl::sycl::atomic_fetch_add(aP[bin], counter_type(1));
+              }
+            });
+      });
+    }
+  }
+
+  {
+    auto bins = sycl::helpers::make_buffer(bins_out, bins_last);
+    q.submit([&](cl::sycl::handler &cgh) {
+      auto aP = partial.template get_access<cl::sycl::access::mode::read>(cgh);
+      auto aB = bins.template get_access<cl::sycl::access::mode::write>(cgh);
+      cgh.parallel_for<MergeName>(
+          cl::sycl::range<1>{num_bins},
+          [aP, aB, nb_rows, num_bins, size](cl::sycl::id<1> id) {
+            size_t bin = id[0];
+            counter_type acc = 0;
+            if (size > 0) {
+              for (size_t row = 0; row < nb_rows; row++) {
+                acc += aP[row * num_bins + bin];
+              }
+            }
+            aB[bin] = static_cast<count_type>(acc);
+          });
+    });
+  }
+  return bins_last;
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_HISTOGRAM__
@@ -30,6 +30,7 @@
 #define __SYCL_IMPL_ALGORITHM_INCLUSIVE_SCAN__
 
 #include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
 #include <sycl/algorithm/buffer_algorithms.hpp>
 
 namespace sycl {
@@ -45,44 +46,65 @@ namespace impl {
 OutputIterator inclusive_scan(ExecutionPolicy &sep, InputIterator b,
                               InputIterator e, OutputIterator o, T init,
                               BinaryOperation bop) {
+  typedef typename std::iterator_traits<OutputIterator>::value_type type_;
   cl::sycl::queue q(sep.get_queue());
-  auto device = q.get_device();
-  // limits us to random access iterators :/
-  *b = bop(*b, init);
+  if (b == e) {
+    return o;
+  }
+  // the input is only read: it may be a buffer shared with other calls
   auto bufI = sycl::helpers::make_const_buffer(b, e);
 
   auto vectorSize = bufI.get_count();
-  // declare a temporary "swap" buffer
   auto bufO = sycl::helpers::make_buffer(o, o + vectorSize);
+  // declare a temporary "swap" buffer
+  auto bufT = sycl::helpers::make_temp_buffer<type_>(vectorSize);
 
   const auto ndRange = sep.calculateNdRange(vectorSize);
   // calculate iteration count, with extra if not a power of two size buffer
+  // the first iteration, which reads the input, always runs
   int iterations = 0;
   for (size_t vs = vectorSize >> 1; vs > 0; vs >>= 1) {
     iterations++;
   }
-  if ((vectorSize & (vectorSize - 1)) != 0) {
+  if ((vectorSize & (vectorSize - 1)) != 0 || iterations == 0) {
     iterations++;
   }
-  // calculate the buffer to read from first, based on modulo arithmetic of the
+  // calculate the buffer to write first, based on modulo arithmetic of the
   // required iteration count so we always finally write to bufO
   // implementation based on "naive" implementation from
   // http://http.developer.nvidia.com/GPUGems3/gpugems3_ch39.html
-  auto inBuf = &bufI;
-  auto outBuf = &bufO;
+  cl::sycl::buffer<type_, 1> *inBuf = &bufT;
+  cl::sycl::buffer<type_, 1> *outBuf = &bufO;
   if (iterations % 2 == 0) {
-    outBuf = &bufI;
-    inBuf = &bufO;
+    std::swap(inBuf, outBuf);
   }
-
-  int i = 1;
-  do {
+  // the first iteration reads the input and folds init into its first
+  // element
+  q.submit([&](cl::sycl::handler &h) {
+    auto aI = bufI.template get_access<cl::sycl::access::mode::read>(h);
+    auto aO = outBuf->template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<
+        cl::sycl::helpers::NameGen<0, typename ExecutionPolicy::kernelName> >(
+        ndRange, [aI, aO, bop, init, vectorSize](cl::sycl::nd_item<1> id) {
+          size_t m_id = id.get_global_id(0);
+          if (m_id == 0) {
+            aO[m_id] = bop(init, aI[m_id]);
+          } else if (m_id == 1) {
+            aO[m_id] = bop(bop(init, aI[m_id - 1]), aI[m_id]);
+          } else if (m_id < vectorSize) {
+            aO[m_id] = bop(aI[m_id - 1], aI[m_id]);
+          }
+        });
+  });
+
+  for (int i = 2; i <= iterations; i++) {
+    // swap the buffers
+    std::swap(inBuf, outBuf);
     auto f = [vectorSize, i, ndRange, inBuf, outBuf, bop](
         cl::sycl::handler &h) {
-      auto aI =
-          inBuf->template get_access<cl::sycl::access::mode::read_write>(h);
+      auto aI = inBuf->template get_access<cl::sycl::access::mode::read>(h);
       auto aO =
-          outBuf->template get_access<cl::sycl::access::mode::read_write>(h);
+          outBuf->template get_access<cl::sycl::access::mode::write>(h);
       h.parallel_for<typename ExecutionPolicy::kernelName>(
           ndRange, [aI, aO, bop, vectorSize, i](cl::sycl::nd_item<1> id) {
             size_t td = 1 << (i - 1);
@@ -90,16 +112,13 @@ OutputIterator inclusive_scan(ExecutionPolicy &sep, InputIterator b,
 
             if (m_id < vectorSize && m_id >= td) {
               aO[m_id] = bop(aI[m_id - td], aI[m_id]);
-            } else {
+            } else if (m_id < vectorSize) {
               aO[m_id] = aI[m_id];
             }
           });
     };
     q.submit(f);
-    // swap the buffers
-    std::swap(inBuf, outBuf);
-    i++;
-  } while (i <= iterations);
+  }
   q.wait_and_throw();
   return o + vectorSize;
 }
@@ -130,9 +149,10 @@ OutputIterator inclusive_scan(ExecutionPolicy &snp, InputIterator b,
 #endif
 
     auto d = compute_mapscan_descriptor(device, size, sizeof(value_type));
-    buffer_mapscan(snp, q, buffer, buffer, init, d,
-                   [](value_type x) { return x; },
-                   bop);
+    buffer_mapscan_single_pass(snp, q, buffer, buffer,
+                               static_cast<value_type>(init), d,
+                               [](value_type x) { return x; },
+                               bop, false);
   }
 
   return std::next(o, size);
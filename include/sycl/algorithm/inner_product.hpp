@@ -127,7 +127,7 @@ T inner_product(ExecutionPolicy &exec, InputIt1 first1, InputIt1 last1,
 
     auto buf1 = sycl::helpers::make_const_buffer(first1, last1);
     auto buf2 = sycl::helpers::make_const_buffer(first2, last2);
-    cl::sycl::buffer<T, 1> bufr((cl::sycl::range<1>(vectorSize)));
+    auto bufr = sycl::helpers::make_temp_buffer<T>(vectorSize);
     auto length = vectorSize;
     auto ndRange = exec.calculateNdRange(length);
     const auto local = ndRange.get_local_range()[0];
@@ -0,0 +1,323 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_MINMAX_ELEMENT__
+#define __SYCL_IMPL_ALGORITHM_MINMAX_ELEMENT__
+
+#include <type_traits>
+#include <iterator>
+#include <utility>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+/** minmax_element_name.
+ * Class used to name the min_element, max_element and minmax_element
+ * kernels per type.
+ */
+template <typename T>
+class minmax_element_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+
+template <class KernelName>
+class sycl_execution_policy;
+
+namespace impl {
+
+/** element_pair.
+ * Element of the range together with its position. The position is the
+ * size of the range for the empty pair used as initial value.
+ */
+template <typename T>
+struct element_pair {
+  size_t index;
+  T value;
+};
+
+/** minmax_pair.
+ * Smallest and largest elements of a part of the range.
+ */
+template <typename T>
+struct minmax_pair {
+  element_pair<T> min;
+  element_pair<T> max;
+};
+
+/** element_less.
+ * Default comparison of min_element, max_element and minmax_element.
+ */
+template <typename T>
+struct element_less {
+  bool operator()(const T &lhs, const T &rhs) const { return lhs < rhs; }
+};
+
+/** element_min.
+ * Keeps the smallest element, the first one among equivalent elements.
+ */
+template <typename T, class Compare>
+struct element_min {
+  Compare comp;
+  size_t size;
+
+  element_pair<T> operator()(const element_pair<T> &lhs,
+                             const element_pair<T> &rhs) const {
+    if (lhs.index == size) {
+      return rhs;
+    }
+    if (rhs.index == size) {
+      return lhs;
+    }
+    if (comp(rhs.value, lhs.value)) {
+      return rhs;
+    }
+    if (comp(lhs.value, rhs.value)) {
+      return lhs;
+    }
+    return (rhs.index < lhs.index) ? rhs : lhs;
+  }
+};
+
+/** element_max.
+ * Keeps the largest element, the first one among equivalent elements, or
+ * the last one when Last is true.
+ */
+template <typename T, class Compare, bool Last>
+struct element_max {
+  Compare comp;
+  size_t size;
+
+  element_pair<T> operator()(const element_pair<T> &lhs,
+                             const element_pair<T> &rhs) const {
+    if (lhs.index == size) {
+      return rhs;
+    }
+    if (rhs.index == size) {
+      return lhs;
+    }
+    if (comp(lhs.value, rhs.value)) {
+      return rhs;
+    }
+    if (comp(rhs.value, lhs.value)) {
+      return lhs;
+    }
+    return ((rhs.index > lhs.index) == Last) ? rhs : lhs;
+  }
+};
+
+/** element_minmax.
+ * Keeps the first smallest and the last largest elements, as
+ * std::minmax_element does.
+ */
+template <typename T, class Compare>
+struct element_minmax {
+  Compare comp;
+  size_t size;
+
+  minmax_pair<T> operator()(const minmax_pair<T> &lhs,
+                            const minmax_pair<T> &rhs) const {
+    minmax_pair<T> res;
+    res.min = element_min<T, Compare>{comp, size}(lhs.min, rhs.min);
+    res.max = element_max<T, Compare, true>{comp, size}(lhs.max, rhs.max);
+    return res;
+  }
+};
+
+/** element_pair_map.
+ * Map of the min_element and max_element reductions.
+ */
+template <typename T>
+struct element_pair_map {
+  element_pair<T> operator()(size_t pos, const T &x) const {
+    element_pair<T> p;
+    p.index = pos;
+    p.value = x;
+    return p;
+  }
+};
+
+/** minmax_pair_map.
+ * Map of the minmax_element reduction.
+ */
+template <typename T>
+struct minmax_pair_map {
+  minmax_pair<T> operator()(size_t pos, const T &x) const {
+    minmax_pair<T> p;
+    p.min = element_pair_map<T>()(pos, x);
+    p.max = p.min;
+    return p;
+  }
+};
+
+/* min_element.
+ * @brief Returns an iterator to the first smallest element of [first, last)
+ * according to comp, computed with a single buffer_mapreduce of the
+ * elements and their positions.
+ */
+template <class ExecutionPolicy, class ForwardIt, class Compare,
+          typename KernelName =
+              minmax_element_name<typename ExecutionPolicy::kernelName>>
+ForwardIt min_element(ExecutionPolicy &sep, ForwardIt first, ForwardIt last,
+                      Compare comp) {
+  typedef typename std::iterator_traits<ForwardIt>::value_type value_type;
+  using MinName = cl::sycl::helpers::NameGen<0, KernelName, value_type>;
+
+  cl::sycl::queue q(sep.get_queue());
+  size_t size = sycl::helpers::distance(first, last);
+  if (size < 1) {
+    return last;
+  }
+  element_pair<value_type> init;
+  init.index = size;
+  init.value = value_type();
+  auto d = compute_mapreduce_descriptor(q.get_device(), size,
+                                        sizeof(element_pair<value_type>));
+  auto input = sycl::helpers::make_const_buffer(first, last);
+  sycl_execution_policy<MinName> msep(q);
+  auto res = impl::buffer_mapreduce(msep, q, input, init, d,
+                              element_pair_map<value_type>(),
+                              element_min<value_type, Compare>{comp, size});
+  return std::next(first, res.index);
+}
+
+/* max_element.
+ * @brief Returns an iterator to the first largest element of [first, last)
+ * according to comp, computed with a single buffer_mapreduce of the
+ * elements and their positions.
+ */
+template <class ExecutionPolicy, class ForwardIt, class Compare,
+          typename KernelName =
+              minmax_element_name<typename ExecutionPolicy::kernelName>>
+ForwardIt max_element(ExecutionPolicy &sep, ForwardIt first, ForwardIt last,
+                      Compare comp) {
+  typedef typename std::iterator_traits<ForwardIt>::value_type value_type;
+  using MaxName = cl::sycl::helpers::NameGen<1, KernelName, value_type>;
+
+  cl::sycl::queue q(sep.get_queue());
+  size_t size = sycl::helpers::distance(first, last);
+  if (size < 1) {
+    return last;
+  }
+  element_pair<value_type> init;
+  init.index = size;
+  init.value = value_type();
+  auto d = compute_mapreduce_descriptor(q.get_device(), size,
+                                        sizeof(element_pair<value_type>));
+  auto input = sycl::helpers::make_const_buffer(first, last);
+  sycl_execution_policy<MaxName> msep(q);
+  auto res = impl::buffer_mapreduce(
+      msep, q, input, init, d, element_pair_map<value_type>(),
+      element_max<value_type, Compare, false>{comp, size});
+  return std::next(first, res.index);
+}
+
+/* minmax_element.
+ * @brief Returns iterators to the first smallest and to the last largest
+ * elements of [first, last) according to comp. Both are computed in the
+ * same buffer_mapreduce, so the range is read once.
+ */
+template <class ExecutionPolicy, class ForwardIt, class Compare,
+          typename KernelName =
+              minmax_element_name<typename ExecutionPolicy::kernelName>>
+std::pair<ForwardIt, ForwardIt> minmax_element(ExecutionPolicy &sep,
+                                               ForwardIt first,
+                                               ForwardIt last,
+                                               Compare comp) {
+  typedef typename std::iterator_traits<ForwardIt>::value_type value_type;
+  using MinMaxName = cl::sycl::helpers::NameGen<2, KernelName, value_type>;
+
+  cl::sycl::queue q(sep.get_queue());
+  size_t size = sycl::helpers::distance(first, last);
+  if (size < 1) {
+    return std::make_pair(last, last);
+  }
+  minmax_pair<value_type> init;
+  init.min.index = size;
+  init.min.value = value_type();
+  init.max = init.min;
+  auto d = compute_mapreduce_descriptor(q.get_device(), size,
+                                        sizeof(minmax_pair<value_type>));
+  auto input = sycl::helpers::make_const_buffer(first, last);
+  sycl_execution_policy<MinMaxName> msep(q);
+  auto res = impl::buffer_mapreduce(msep, q, input, init, d,
+                              minmax_pair_map<value_type>(),
+                              element_minmax<value_type, Compare>{comp, size});
+  return std::make_pair(std::next(first, res.min.index),
+                        std::next(first, res.max.index));
+}
+
+/* min_element.
+ * @brief Returns an iterator to the first smallest element of [first, last).
+ * The kernel names are distinct from the ones used with a user comparison.
+ */
+template <class ExecutionPolicy, class ForwardIt>
+ForwardIt min_element(ExecutionPolicy &sep, ForwardIt first, ForwardIt last) {
+  typedef typename std::iterator_traits<ForwardIt>::value_type value_type;
+  typedef typename ExecutionPolicy::kernelName kernelName;
+  return min_element<ExecutionPolicy, ForwardIt, element_less<value_type>,
+                     minmax_element_name<element_less<kernelName>>>(
+      sep, first, last, element_less<value_type>());
+}
+
+/* max_element.
+ * @brief Returns an iterator to the first largest element of [first, last).
+ * The kernel names are distinct from the ones used with a user comparison.
+ */
+template <class ExecutionPolicy, class ForwardIt>
+ForwardIt max_element(ExecutionPolicy &sep, ForwardIt first, ForwardIt last) {
+  typedef typename std::iterator_traits<ForwardIt>::value_type value_type;
+  typedef typename ExecutionPolicy::kernelName kernelName;
+  return max_element<ExecutionPolicy, ForwardIt, element_less<value_type>,
+                     minmax_element_name<element_less<kernelName>>>(
+      sep, first, last, element_less<value_type>());
+}
+
+/* minmax_element.
+ * @brief Returns iterators to the first smallest and to the last largest
+ * elements of [first, last).
+ * The kernel names are distinct from the ones used with a user comparison.
+ */
+template <class ExecutionPolicy, class ForwardIt>
+std::pair<ForwardIt, ForwardIt> minmax_element(ExecutionPolicy &sep,
+                                               ForwardIt first,
+                                               ForwardIt last) {
+  typedef typename std::iterator_traits<ForwardIt>::value_type value_type;
+  typedef typename ExecutionPolicy::kernelName kernelName;
+  return minmax_element<ExecutionPolicy, ForwardIt, element_less<value_type>,
+                        minmax_element_name<element_less<kernelName>>>(
+      sep, first, last, element_less<value_type>());
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_MINMAX_ELEMENT__
@@ -70,7 +70,7 @@ std::pair<ForwardIt1, ForwardIt2> mismatch(ExecutionPolicy& exec,
   auto buf1 = sycl::helpers::make_const_buffer(first1, first1 + length);
   auto buf2 = sycl::helpers::make_const_buffer(first2, first2 + length);
 
-  cl::sycl::buffer<std::size_t, 1> bufR((cl::sycl::range<1>(size1)));
+  auto bufR = sycl::helpers::make_temp_buffer<std::size_t>(size1);
 
   // map across the input testing whether they match the predicate
   const auto eqf = [length, ndRange, &buf1, &buf2, &bufR,
@@ -121,7 +121,7 @@ std::pair<ForwardIt1, ForwardIt2> mismatch(ExecutionPolicy& exec,
                                     ndRange.get_local_range()};
   } while (current_length > 1);
   q.wait_and_throw();
-  const auto hR = bufR.get_access<cl::sycl::access::mode::read>(
+  const auto hR = bufR.template get_access<cl::sycl::access::mode::read>(
       cl::sycl::range<1>{1}, cl::sycl::id<1>{0});
 
   const auto mismatch_id = hR[0];
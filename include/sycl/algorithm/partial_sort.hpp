@@ -0,0 +1,419 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_PARTIAL_SORT__
+#define __SYCL_IMPL_ALGORITHM_PARTIAL_SORT__
+
+#include <type_traits>
+#include <algorithm>
+#include <iterator>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/sort.hpp>
+#include <sycl/algorithm/sort_by_key.hpp>
+#include <sycl/algorithm/stable_sort.hpp>
+
+/** top_k_name.
+ * Class used to name the top-k kernels per type.
+ */
+template <typename T>
+class top_k_name {
+  T userGivenKernelName;
+};
+
+/** partial_sort_name.
+ * Class used to name the partial sort kernels per type.
+ */
+template <typename T>
+class partial_sort_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+namespace impl {
+
+/* top_k_merge.
+ * Merges every pair of consecutive sorted runs of src into dst, keeping
+ * only the first newRunLength elements of each merged run.
+ * All the runs have runLength elements, except the last one which may be
+ * shorter. Each work-item finds the position of its element in the other run
+ * of the pair with a binary search, as for stable_sort.
+ */
+template <typename T, typename Alloc, class ComparableOperator, typename Name>
+void top_k_merge(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> src,
+                 cl::sycl::buffer<T, 1, Alloc> dst, size_t size,
+                 size_t runLength, size_t newRunLength,
+                 ComparableOperator comp) {
+  q.submit([&](cl::sycl::handler &h) {
+    auto aS = src.template get_access<cl::sycl::access::mode::read>(h);
+    auto aD = dst.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<Name>(
+        cl::sycl::range<1>{size},
+        [aS, aD, size, runLength, newRunLength, comp](cl::sycl::id<1> id) {
+          const size_t p = id[0];
+          const size_t run = p / runLength;
+          const size_t runStart = run * runLength;
+          const T x = aS[p];
+
+          size_t lo, rank;
+          if (run % 2 == 0) {
+            // Number of elements of the right run placed before x
+            const size_t other = std::min(runStart + runLength, size);
+            size_t hi = std::min(other + runLength, size);
+            lo = other;
+            while (lo < hi) {
+              const size_t m = lo + (hi - lo) / 2;
+              if (stable_sort_after(x, aS[m], comp)) {
+                lo = m + 1;
+              } else {
+                hi = m;
+              }
+            }
+            rank = lo - other;
+          } else {
+            // Number of elements of the left run placed before x
+            const size_t other = runStart - runLength;
+            size_t hi = runStart;
+            lo = other;
+            while (lo < hi) {
+              const size_t m = lo + (hi - lo) / 2;
+              if (!stable_sort_after(aS[m], x, comp)) {
+                lo = m + 1;
+              } else {
+                hi = m;
+              }
+            }
+            rank = lo - other;
+          }
+
+          const size_t pos = (p - runStart) + rank;
+          if (pos < newRunLength) {
+            aD[(run / 2) * newRunLength + pos] = x;
+          }
+        });
+  });
+}
+
+/* top_k.
+ * Selects the k first elements of the buffer in the order given by comp.
+ * Every work-group sorts a block in local memory with the bitonic network of
+ * stable_sort_block, then the sorted runs are merged pairwise and every
+ * merged run is cut to k elements, so only the candidates of each block take
+ * part in the following merges. Both steps are stable, hence equivalent
+ * elements are selected in the order of the buffer.
+ * The content of buf is not preserved. Returns the buffer holding the k
+ * first elements, sorted, at its beginning.
+ */
+template <typename T, typename Alloc, class ComparableOperator,
+          typename KernelName>
+cl::sycl::buffer<T, 1, Alloc> top_k(cl::sycl::queue q,
+                                    cl::sycl::buffer<T, 1, Alloc> buf,
+                                    size_t vectorSize, size_t k,
+                                    ComparableOperator comp) {
+  using BlockName = cl::sycl::helpers::NameGen<0, KernelName, T>;
+  using MergeName = cl::sycl::helpers::NameGen<1, KernelName, T>;
+
+  const size_t blockSize =
+      stable_sort_block_size<T>(q.get_device(), vectorSize);
+  stable_sort_block<T, Alloc, ComparableOperator, BlockName>(
+      q, buf, vectorSize, blockSize, comp);
+
+  cl::sycl::buffer<T, 1, Alloc> tmp{cl::sycl::range<1>{vectorSize}};
+#ifndef TRISYCL_CL_LANGUAGE_VERSION
+  tmp.set_final_data(nullptr);
+#endif
+  auto src = buf;
+  auto dst = tmp;
+  size_t size = vectorSize;
+  size_t runLength = blockSize;
+  size_t nbRuns = up_rounded_division(size, runLength);
+  while (nbRuns > 1) {
+    const size_t newRunLength = std::min(2 * runLength, k);
+    const size_t lastRunLength = size - (nbRuns - 1) * runLength;
+    const size_t newNbRuns = up_rounded_division(nbRuns, 2);
+    const size_t newLastRunLength =
+        (nbRuns % 2 == 0) ? std::min(runLength + lastRunLength, k)
+                          : std::min(lastRunLength, k);
+
+    top_k_merge<T, Alloc, ComparableOperator, MergeName>(
+        q, src, dst, size, runLength, newRunLength, comp);
+
+    size = (newNbRuns - 1) * newRunLength + newLastRunLength;
+    runLength = newRunLength;
+    nbRuns = newNbRuns;
+    std::swap(src, dst);
+  }
+  return src;
+}
+
+/** top_k
+ * @brief Function that copies the k first elements of the range, in the
+ * order given by comp, to the output range
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param last  : End of the range
+ * @param k     : Number of elements to select
+ * @param out   : Start of the output range
+ * @param comp  : Comp Operator, returns true when the first element must be
+ *                placed after the second one
+ * @return End of the output range
+ */
+template <class ExecutionPolicy, class RandomIt, class OutputIt,
+          class ComparableOperator,
+          typename KernelName =
+              top_k_name<typename ExecutionPolicy::kernelName>>
+OutputIt top_k(ExecutionPolicy &sep, RandomIt first, RandomIt last, size_t k,
+               OutputIt out, ComparableOperator comp) {
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  using CopyName = cl::sycl::helpers::NameGen<2, KernelName, type_>;
+  using OutputName = cl::sycl::helpers::NameGen<3, KernelName, type_>;
+
+  cl::sycl::queue q(sep.get_queue());
+  const size_t vectorSize = sycl::helpers::distance(first, last);
+  k = std::min(k, vectorSize);
+  if (k == 0) {
+    return out;
+  }
+  auto out_last = out;
+  std::advance(out_last, k);
+
+  {
+    auto in = sycl::helpers::make_const_buffer(first, last);
+    auto work = sycl::helpers::make_temp_buffer<type_>(vectorSize);
+    q.submit([&](cl::sycl::handler &h) {
+      auto aI = in.template get_access<cl::sycl::access::mode::read>(h);
+      auto aW = work.template get_access<cl::sycl::access::mode::write>(h);
+      h.parallel_for<CopyName>(
+          cl::sycl::range<1>{vectorSize},
+          [aI, aW](cl::sycl::id<1> id) { aW[id] = aI[id]; });
+    });
+
+    typedef typename buffer_traits<decltype(work)>::allocator_type alloc_;
+    auto selected = top_k<type_, alloc_, ComparableOperator, KernelName>(
+        q, work, vectorSize, k, comp);
+
+    auto outBuf = sycl::helpers::make_buffer(out, out_last);
+    q.submit([&](cl::sycl::handler &h) {
+      auto aS = selected.template get_access<cl::sycl::access::mode::read>(h);
+      auto aO = outBuf.template get_access<cl::sycl::access::mode::write>(h);
+      h.parallel_for<OutputName>(
+          cl::sycl::range<1>{k},
+          [aS, aO](cl::sycl::id<1> id) { aO[id] = aS[id]; });
+    });
+  }
+  return out_last;
+}
+
+/** top_k
+ * @brief Function that copies the k smallest elements of the range, in
+ * increasing order, to the output range
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param last  : End of the range
+ * @param k     : Number of elements to select
+ * @param out   : Start of the output range
+ * @return End of the output range
+ */
+template <class ExecutionPolicy, class RandomIt, class OutputIt>
+OutputIt top_k(ExecutionPolicy &sep, RandomIt first, RandomIt last, size_t k,
+               OutputIt out) {
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  typedef typename ExecutionPolicy::kernelName kernelName;
+  return top_k<ExecutionPolicy, RandomIt, OutputIt, sort_greater<type_>,
+               top_k_name<sort_greater<kernelName>>>(sep, first, last, k, out,
+                                                     sort_greater<type_>());
+}
+
+/** partial_sort
+ * @brief Function that rearranges the range so that [first, middle) holds
+ * the first elements in the order given by comp, sorted. The order of the
+ * elements in [middle, last) is unspecified.
+ * The elements are selected with top_k together with their index, then the
+ * remaining elements are packed after them, keeping their relative order.
+ * @param sep    : Execution Policy
+ * @param first  : Start of the range
+ * @param middle : End of the range to sort
+ * @param last   : End of the range
+ * @param comp   : Comp Operator, returns true when the first element must be
+ *                 placed after the second one
+ */
+template <class ExecutionPolicy, class RandomIt, class ComparableOperator,
+          typename KernelName =
+              partial_sort_name<typename ExecutionPolicy::kernelName>>
+void partial_sort(ExecutionPolicy &sep, RandomIt first, RandomIt middle,
+                  RandomIt last, ComparableOperator comp) {
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  typedef key_index_pair<type_> pair_type;
+  typedef key_index_comp<type_, ComparableOperator, true> pair_comp;
+  using InitName = cl::sycl::helpers::NameGen<2, KernelName, type_>;
+  using IndexName = cl::sycl::helpers::NameGen<3, KernelName, type_>;
+  using SortName = cl::sycl::helpers::NameGen<4, KernelName, type_>;
+  using PackName = cl::sycl::helpers::NameGen<5, KernelName, type_>;
+  using CopyName = cl::sycl::helpers::NameGen<6, KernelName, type_>;
+
+  cl::sycl::queue q(sep.get_queue());
+  const size_t vectorSize = sycl::helpers::distance(first, last);
+  const size_t k = sycl::helpers::distance(first, middle);
+  if (k == 0 || vectorSize < 2) {
+    return;
+  }
+
+  auto buf = sycl::helpers::make_buffer(first, last);
+  auto pairs = sycl::helpers::make_temp_buffer<pair_type>(vectorSize);
+  auto indices = sycl::helpers::make_temp_buffer<size_t>(k);
+  auto result = sycl::helpers::make_temp_buffer<type_>(vectorSize);
+
+  q.submit([&](cl::sycl::handler &h) {
+    auto a = buf.template get_access<cl::sycl::access::mode::read>(h);
+    auto aP = pairs.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<InitName>(cl::sycl::range<1>{vectorSize},
+                             [a, aP](cl::sycl::id<1> id) {
+                               pair_type p;
+                               p.key = a[id];
+                               p.index = id[0];
+                               aP[id] = p;
+                             });
+  });
+
+  auto selected =
+      top_k<pair_type, typename buffer_traits<decltype(pairs)>::allocator_type,
+            pair_comp, KernelName>(q, pairs, vectorSize, k, pair_comp{comp});
+
+  // Indices of the selected elements, sorted
+  q.submit([&](cl::sycl::handler &h) {
+    auto aS = selected.template get_access<cl::sycl::access::mode::read>(h);
+    auto aI = indices.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<IndexName>(
+        cl::sycl::range<1>{k},
+        [aS, aI](cl::sycl::id<1> id) { aI[id] = aS[id].index; });
+  });
+  typedef typename buffer_traits<decltype(indices)>::allocator_type alloc_;
+  bitonic_sort<size_t, alloc_, sort_greater<size_t>, SortName>(
+      q, indices, k, sort_greater<size_t>());
+
+  q.submit([&](cl::sycl::handler &h) {
+    auto a = buf.template get_access<cl::sycl::access::mode::read>(h);
+    auto aS = selected.template get_access<cl::sycl::access::mode::read>(h);
+    auto aI = indices.template get_access<cl::sycl::access::mode::read>(h);
+    auto aR = result.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<PackName>(
+        cl::sycl::range<1>{vectorSize},
+        [a, aS, aI, aR, k](cl::sycl::id<1> id) {
+          const size_t i = id[0];
+          if (i < k) {
+            aR[i] = aS[i].key;
+          }
+          // Number of selected elements before i
+          size_t lo = 0, hi = k;
+          while (lo < hi) {
+            const size_t m = lo + (hi - lo) / 2;
+            if (aI[m] < i) {
+              lo = m + 1;
+            } else {
+              hi = m;
+            }
+          }
+          if (lo == k || aI[lo] != i) {
+            aR[k + i - lo] = a[i];
+          }
+        });
+  });
+
+  q.submit([&](cl::sycl::handler &h) {
+    auto aR = result.template get_access<cl::sycl::access::mode::read>(h);
+    auto a = buf.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<CopyName>(cl::sycl::range<1>{vectorSize},
+                             [aR, a](cl::sycl::id<1> id) { a[id] = aR[id]; });
+  });
+}
+
+/** partial_sort
+ * @brief Function that rearranges the range so that [first, middle) holds
+ * the smallest elements in increasing order
+ * @param sep    : Execution Policy
+ * @param first  : Start of the range
+ * @param middle : End of the range to sort
+ * @param last   : End of the range
+ */
+template <class ExecutionPolicy, class RandomIt>
+void partial_sort(ExecutionPolicy &sep, RandomIt first, RandomIt middle,
+                  RandomIt last) {
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  typedef typename ExecutionPolicy::kernelName kernelName;
+  partial_sort<ExecutionPolicy, RandomIt, sort_greater<type_>,
+               partial_sort_name<sort_greater<kernelName>>>(
+      sep, first, middle, last, sort_greater<type_>());
+}
+
+/** nth_element
+ * @brief Function that rearranges the range so that nth holds the element
+ * that would be there if the range was sorted, with no element after nth
+ * placed before it. It is a partial sort of [first, nth].
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param nth   : Position of the element
+ * @param last  : End of the range
+ * @param comp  : Comp Operator, returns true when the first element must be
+ *                placed after the second one
+ */
+template <class ExecutionPolicy, class RandomIt, class ComparableOperator>
+void nth_element(ExecutionPolicy &sep, RandomIt first, RandomIt nth,
+                 RandomIt last, ComparableOperator comp) {
+  if (nth == last) {
+    return;
+  }
+  auto middle = nth;
+  ++middle;
+  partial_sort(sep, first, middle, last, comp);
+}
+
+/** nth_element
+ * @brief Function that rearranges the range so that nth holds the element
+ * that would be there if the range was sorted in increasing order
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param nth   : Position of the element
+ * @param last  : End of the range
+ */
+template <class ExecutionPolicy, class RandomIt>
+void nth_element(ExecutionPolicy &sep, RandomIt first, RandomIt nth,
+                 RandomIt last) {
+  if (nth == last) {
+    return;
+  }
+  auto middle = nth;
+  ++middle;
+  partial_sort(sep, first, middle, last);
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_PARTIAL_SORT__
@@ -51,25 +51,18 @@ namespace impl {
  * input-output
  */
 #ifdef SYCL_PSTL_USE_OLD_ALGO
+/* reduce_in_place.
+ * Reduces the first length elements of bufI, overwriting them with the
+ * partial results.
+ */
 template <typename ExecutionPolicy,
-          typename Iterator,
+          typename type_,
+          typename Alloc,
           typename T,
           typename BinaryOperation>
-typename std::iterator_traits<Iterator>::value_type reduce(
-    ExecutionPolicy &sep, Iterator b, Iterator e, T init, BinaryOperation bop) {
-  cl::sycl::queue q(sep.get_queue());
-
-  auto vectorSize = sycl::helpers::distance(b, e);
-
-  if (vectorSize < 1) {
-    return init;
-  }
-
-  auto device = q.get_device();
-
-  typedef typename std::iterator_traits<Iterator>::value_type type_;
-  auto bufI = sycl::helpers::make_const_buffer(b, e);
-  auto length = vectorSize;
+type_ reduce_in_place(ExecutionPolicy &sep, cl::sycl::queue q,
+                      cl::sycl::buffer<type_, 1, Alloc> &bufI, size_t length,
+                      T init, BinaryOperation bop) {
   auto ndRange = sep.calculateNdRange(length);
   const auto local = ndRange.get_local_range()[0];
 
@@ -97,6 +90,37 @@ typename std::iterator_traits<Iterator>::value_type reduce(
   auto hI = bufI.template get_access<cl::sycl::access::mode::read>();
   return bop(hI[0], init);
 }
+
+/* reduce.
+ * The input is reduced in its own buffer, or in a copy when its buffer is
+ * shared with other calls.
+ */
+template <typename ExecutionPolicy,
+          typename Iterator,
+          typename T,
+          typename BinaryOperation>
+typename std::iterator_traits<Iterator>::value_type reduce(
+    ExecutionPolicy &sep, Iterator b, Iterator e, T init, BinaryOperation bop) {
+  typedef typename std::iterator_traits<Iterator>::value_type type_;
+  using CopyName =
+      cl::sycl::helpers::NameGen<1, typename ExecutionPolicy::kernelName,
+                                 type_>;
+  cl::sycl::queue q(sep.get_queue());
+
+  auto vectorSize = sycl::helpers::distance(b, e);
+
+  if (vectorSize < 1) {
+    return init;
+  }
+
+  auto bufI = sycl::helpers::make_const_buffer(b, e);
+  if (sycl::helpers::is_shared_range(b, e)) {
+    auto copy =
+        sycl::helpers::copy_to_temp_buffer<CopyName>(q, bufI, vectorSize);
+    return reduce_in_place(sep, q, copy, vectorSize, init, bop);
+  }
+  return reduce_in_place(sep, q, bufI, vectorSize, init, bop);
+}
 #else
 
 
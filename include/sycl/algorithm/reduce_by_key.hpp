@@ -0,0 +1,215 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_REDUCE_BY_KEY__
+#define __SYCL_IMPL_ALGORITHM_REDUCE_BY_KEY__
+
+#include <type_traits>
+#include <iterator>
+#include <utility>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+#include <sycl/algorithm/unique.hpp>
+
+/** reduce_by_key_name.
+ * Class used to name the reduce by key kernels per type.
+ */
+template <typename T>
+class reduce_by_key_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+
+template <class KernelName>
+class sycl_execution_policy;
+
+namespace impl {
+
+/** reduce_by_key_pair.
+ * Value to scan together with the number of segments started so far.
+ */
+template <typename T>
+struct reduce_by_key_pair {
+  size_t segment;
+  T value;
+};
+
+/** reduce_by_key_op.
+ * Segmented version of the user operation that also counts the segments:
+ * the value restarts at every pair that starts a segment, and after the
+ * scan the segment of a pair is its position in the output.
+ */
+template <typename T, class BinaryOperation>
+struct reduce_by_key_op {
+  BinaryOperation op;
+
+  reduce_by_key_pair<T> operator()(const reduce_by_key_pair<T> &lhs,
+                                   const reduce_by_key_pair<T> &rhs) const {
+    reduce_by_key_pair<T> res;
+    res.segment = lhs.segment + rhs.segment;
+    res.value = (rhs.segment > 0) ? rhs.value : op(lhs.value, rhs.value);
+    return res;
+  }
+};
+
+/* reduce_by_key.
+ * @brief For every group of consecutive equivalent keys of
+ * [keys_first, keys_last), writes the first key to the range beginning at
+ * keys_out and the reduction of the corresponding values to the range
+ * beginning at values_out.
+ * A first kernel pairs every value with a segment head flag, a single-pass
+ * segmented scan reduces the segments and numbers them, and a last kernel
+ * writes the first key and the last partial reduction of every segment.
+ * Only the number of segments is read back on the host, to size the
+ * outputs.
+ * @param sep          : Execution Policy
+ * @param keys_first   : Start of the range of keys
+ * @param keys_last    : End of the range of keys
+ * @param values_first : Start of the range of values
+ * @param keys_out     : Start of the output range of keys
+ * @param values_out   : Start of the output range of values
+ * @param pred         : Binary predicate, returns true when two keys belong
+ *                       to the same segment
+ * @param op           : Binary operator
+ * @return  The ends of both output ranges
+ */
+template <class ExecutionPolicy, class KeyIt, class ValueIt, class KeyOutIt,
+          class ValueOutIt, class BinaryPredicate, class BinaryOperation>
+std::pair<KeyOutIt, ValueOutIt> reduce_by_key(
+    ExecutionPolicy &sep, KeyIt keys_first, KeyIt keys_last,
+    ValueIt values_first, KeyOutIt keys_out, ValueOutIt values_out,
+    BinaryPredicate pred, BinaryOperation op) {
+  typedef typename std::iterator_traits<KeyIt>::value_type key_type;
+  typedef typename std::iterator_traits<ValueIt>::value_type value_type;
+  typedef reduce_by_key_pair<value_type> pair_type;
+  typedef reduce_by_key_name<typename ExecutionPolicy::kernelName> kernelName;
+  using PackName =
+      cl::sycl::helpers::NameGen<0, kernelName, key_type, value_type>;
+  using ScatterName =
+      cl::sycl::helpers::NameGen<1, kernelName, key_type, value_type>;
+  using ScanName =
+      cl::sycl::helpers::NameGen<2, kernelName, key_type, value_type>;
+
+  cl::sycl::queue q(sep.get_queue());
+  size_t vectorSize = sycl::helpers::distance(keys_first, keys_last);
+  if (vectorSize < 1) {
+    return std::make_pair(keys_out, values_out);
+  }
+  auto values_last = values_first;
+  std::advance(values_last, vectorSize);
+
+  auto keys = sycl::helpers::make_const_buffer(keys_first, keys_last);
+  auto values = sycl::helpers::make_const_buffer(values_first, values_last);
+  auto pairs = sycl::helpers::make_temp_buffer<pair_type>(vectorSize);
+
+  q.submit([&](cl::sycl::handler &h) {
+    auto aK = keys.template get_access<cl::sycl::access::mode::read>(h);
+    auto aV = values.template get_access<cl::sycl::access::mode::read>(h);
+    auto aP = pairs.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<PackName>(
+        cl::sycl::range<1>{vectorSize},
+        [aK, aV, aP, pred](cl::sycl::id<1> id) {
+          size_t pos = id[0];
+          pair_type p;
+          p.segment = ((pos == 0) || !pred(aK[pos - 1], aK[pos])) ? 1 : 0;
+          p.value = aV[pos];
+          aP[pos] = p;
+        });
+  });
+
+  // the first pair always starts a segment, so the value of pinit never
+  // reaches the output
+  pair_type pinit;
+  pinit.segment = 0;
+  pinit.value = value_type();
+  auto d = compute_mapscan_descriptor(q.get_device(), vectorSize,
+                                      sizeof(pair_type));
+  sycl_execution_policy<ScanName> ssep(q);
+  impl::buffer_mapscan_single_pass(
+      ssep, q, pairs, pairs, pinit, d, scan_identity<pair_type>(),
+      reduce_by_key_op<value_type, BinaryOperation>{op}, false);
+
+  size_t count;
+  {
+    auto hP = pairs.template get_access<cl::sycl::access::mode::read>();
+    count = hP[vectorSize - 1].segment;
+  }
+  auto keys_last_out = std::next(keys_out, count);
+  auto values_last_out = std::next(values_out, count);
+  {
+    auto oK = sycl::helpers::make_buffer(keys_out, keys_last_out);
+    auto oV = sycl::helpers::make_buffer(values_out, values_last_out);
+    q.submit([&](cl::sycl::handler &h) {
+      auto aK = keys.template get_access<cl::sycl::access::mode::read>(h);
+      auto aP = pairs.template get_access<cl::sycl::access::mode::read>(h);
+      auto aOK = oK.template get_access<cl::sycl::access::mode::write>(h);
+      auto aOV = oV.template get_access<cl::sycl::access::mode::write>(h);
+      h.parallel_for<ScatterName>(
+          cl::sycl::range<1>{vectorSize},
+          [aK, aP, aOK, aOV, vectorSize](cl::sycl::id<1> id) {
+            size_t pos = id[0];
+            size_t segment = aP[pos].segment;
+            if ((pos == 0) || (aP[pos - 1].segment != segment)) {
+              aOK[segment - 1] = aK[pos];
+            }
+            if ((pos == vectorSize - 1) ||
+                (aP[pos + 1].segment != segment)) {
+              aOV[segment - 1] = aP[pos].value;
+            }
+          });
+    });
+  }
+  return std::make_pair(keys_last_out, values_last_out);
+}
+
+/* count_by_key.
+ * @brief For every group of consecutive equivalent keys of
+ * [keys_first, keys_last), writes the first key to the range beginning at
+ * keys_out and the number of keys of the group to the range beginning at
+ * counts_out. This is the run length encoding of the keys.
+ */
+template <class ExecutionPolicy, class KeyIt, class KeyOutIt,
+          class CountOutIt, class BinaryPredicate>
+std::pair<KeyOutIt, CountOutIt> count_by_key(ExecutionPolicy &sep,
+                                             KeyIt keys_first,
+                                             KeyIt keys_last,
+                                             KeyOutIt keys_out,
+                                             CountOutIt counts_out,
+                                             BinaryPredicate pred) {
+  return impl::run_length_encode(sep, keys_first, keys_last, keys_out,
+                                 counts_out, pred);
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_REDUCE_BY_KEY__
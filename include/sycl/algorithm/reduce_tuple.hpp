@@ -0,0 +1,220 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_REDUCE_TUPLE__
+#define __SYCL_IMPL_ALGORITHM_REDUCE_TUPLE__
+
+#include <type_traits>
+#include <iterator>
+#include <tuple>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+/** reduce_tuple_name.
+ * Class used to name the kernels of the reductions of tuples per type.
+ */
+template <typename T>
+class reduce_tuple_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+
+template <class KernelName>
+class sycl_execution_policy;
+
+namespace impl {
+
+/** reduce_tuple_value.
+ * Results of a list of reducers: the result of the first reducer, then the
+ * results of the others. Unlike std::tuple, it can be stored in buffers and
+ * in local memory.
+ */
+template <typename T, typename Tail>
+struct reduce_tuple_value {
+  T head;
+  Tail tail;
+};
+
+/** reduce_tuple_nil.
+ * Results of an empty list of reducers.
+ */
+struct reduce_tuple_nil {};
+
+/** reduce_tuple_list.
+ * Reducers I and following of the tuple Reducers, where every reducer is a
+ * std::tuple of a map, a binary operation and an initial value.
+ * The list applies all the reducers at once, so a single buffer_mapreduce
+ * computes all the results.
+ */
+template <size_t I, class Reducers,
+          bool End = (I == std::tuple_size<Reducers>::value)>
+struct reduce_tuple_list;
+
+template <size_t I, class Reducers>
+struct reduce_tuple_list<I, Reducers, true> {
+  typedef reduce_tuple_nil value_type;
+  typedef std::tuple<> tuple_type;
+
+  explicit reduce_tuple_list(const Reducers &) {}
+
+  static value_type init(const Reducers &) { return value_type(); }
+
+  template <typename A>
+  value_type map(const A &) const {
+    return value_type();
+  }
+
+  value_type reduce(const value_type &, const value_type &) const {
+    return value_type();
+  }
+
+  static tuple_type to_tuple(const value_type &) { return tuple_type(); }
+};
+
+template <size_t I, class Reducers>
+struct reduce_tuple_list<I, Reducers, false> {
+  typedef typename std::tuple_element<I, Reducers>::type reducer_type;
+  typedef typename std::tuple_element<0, reducer_type>::type map_type;
+  typedef typename std::tuple_element<1, reducer_type>::type op_type;
+  typedef typename std::tuple_element<2, reducer_type>::type result_type;
+  typedef reduce_tuple_list<I + 1, Reducers> tail_type;
+  typedef reduce_tuple_value<result_type, typename tail_type::value_type>
+      value_type;
+  typedef decltype(std::tuple_cat(
+      std::declval<std::tuple<result_type>>(),
+      std::declval<typename tail_type::tuple_type>())) tuple_type;
+
+  map_type map_head;
+  op_type op_head;
+  tail_type tail;
+
+  explicit reduce_tuple_list(const Reducers &reducers)
+      : map_head(std::get<0>(std::get<I>(reducers))),
+        op_head(std::get<1>(std::get<I>(reducers))),
+        tail(reducers) {}
+
+  static value_type init(const Reducers &reducers) {
+    value_type v;
+    v.head = std::get<2>(std::get<I>(reducers));
+    v.tail = tail_type::init(reducers);
+    return v;
+  }
+
+  template <typename A>
+  value_type map(const A &x) const {
+    value_type v;
+    v.head = map_head(x);
+    v.tail = tail.map(x);
+    return v;
+  }
+
+  value_type reduce(const value_type &lhs, const value_type &rhs) const {
+    value_type v;
+    v.head = op_head(lhs.head, rhs.head);
+    v.tail = tail.reduce(lhs.tail, rhs.tail);
+    return v;
+  }
+
+  static tuple_type to_tuple(const value_type &v) {
+    return std::tuple_cat(std::make_tuple(v.head), tail_type::to_tuple(v.tail));
+  }
+};
+
+/** reduce_tuple_map.
+ * Map of the buffer_mapreduce of a list of reducers.
+ */
+template <class List>
+struct reduce_tuple_map {
+  List list;
+
+  template <typename A>
+  typename List::value_type operator()(size_t, const A &x) const {
+    return list.map(x);
+  }
+};
+
+/** reduce_tuple_op.
+ * Reduction of the buffer_mapreduce of a list of reducers.
+ */
+template <class List>
+struct reduce_tuple_op {
+  List list;
+
+  typename List::value_type operator()(
+      const typename List::value_type &lhs,
+      const typename List::value_type &rhs) const {
+    return list.reduce(lhs, rhs);
+  }
+};
+
+/* reduce_tuple.
+ * @brief Applies every reducer of the tuple to the range [first, last) and
+ * returns the tuple of the results. A reducer is a std::tuple of a map, a
+ * binary operation and an initial value: its result is the reduction with
+ * the operation of init and of the elements transformed by the map.
+ * The results of all the reducers are combined into a single accumulator,
+ * so one buffer_mapreduce reads the range once for all of them.
+ * @param sep      : Execution Policy
+ * @param first    : Start of the range
+ * @param last     : End of the range
+ * @param reducers : Tuple of reducers
+ */
+template <class ExecutionPolicy, class InputIt, class Reducers>
+typename reduce_tuple_list<0, Reducers>::tuple_type reduce_tuple(
+    ExecutionPolicy &sep, InputIt first, InputIt last, Reducers reducers) {
+  typedef typename std::iterator_traits<InputIt>::value_type value_type;
+  typedef reduce_tuple_list<0, Reducers> list_type;
+  typedef typename list_type::value_type result_type;
+  typedef reduce_tuple_name<typename ExecutionPolicy::kernelName> kernelName;
+  using ReduceName = cl::sycl::helpers::NameGen<0, kernelName, value_type>;
+
+  result_type init = list_type::init(reducers);
+  cl::sycl::queue q(sep.get_queue());
+  size_t size = sycl::helpers::distance(first, last);
+  if (size < 1) {
+    return list_type::to_tuple(init);
+  }
+  list_type list(reducers);
+  auto d = compute_mapreduce_descriptor(q.get_device(), size,
+                                        sizeof(result_type));
+  auto input = sycl::helpers::make_const_buffer(first, last);
+  sycl_execution_policy<ReduceName> rsep(q);
+  auto res = impl::buffer_mapreduce(rsep, q, input, init, d,
+                              reduce_tuple_map<list_type>{list},
+                              reduce_tuple_op<list_type>{list});
+  return list_type::to_tuple(res);
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_REDUCE_TUPLE__
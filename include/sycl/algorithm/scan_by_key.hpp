@@ -0,0 +1,201 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_SCAN_BY_KEY__
+#define __SYCL_IMPL_ALGORITHM_SCAN_BY_KEY__
+
+#include <type_traits>
+#include <algorithm>
+#include <iterator>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+/** scan_by_key_name.
+ * Class used to name the scan by key kernels per type.
+ */
+template <typename T>
+class scan_by_key_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+
+template <class KernelName>
+class sycl_execution_policy;
+
+namespace impl {
+
+/** scan_by_key_pair.
+ * Value to scan together with a flag set on the first element of each
+ * segment of equal keys.
+ */
+template <typename T>
+struct scan_by_key_pair {
+  bool flag;
+  T value;
+};
+
+/** scan_by_key_op.
+ * Segmented version of the user operation: the scan restarts at every
+ * element whose flag is set. The operation stays associative, so the pairs
+ * can be scanned by buffer_mapscan_single_pass.
+ */
+template <typename T, class BinaryOperation>
+struct scan_by_key_op {
+  BinaryOperation op;
+
+  scan_by_key_pair<T> operator()(const scan_by_key_pair<T> &lhs,
+                                 const scan_by_key_pair<T> &rhs) const {
+    scan_by_key_pair<T> res;
+    res.flag = lhs.flag || rhs.flag;
+    res.value = rhs.flag ? rhs.value : op(lhs.value, rhs.value);
+    return res;
+  }
+};
+
+/** scan_by_key_equal.
+ * Default predicate of the scan by key: keys are compared with ==.
+ */
+template <typename T>
+struct scan_by_key_equal {
+  bool operator()(const T &lhs, const T &rhs) const { return lhs == rhs; }
+};
+
+/** scan_by_key_plus.
+ * Default operation of the scan by key.
+ */
+template <typename T>
+struct scan_by_key_plus {
+  T operator()(const T &lhs, const T &rhs) const { return lhs + rhs; }
+};
+
+/* scan_by_key.
+ * @brief Scans the values starting at values_first, restarting the scan
+ * whenever two consecutive keys of [keys_first, keys_last) are not equal
+ * according to pred.
+ * A first kernel pairs every value with a segment head flag, the pairs are
+ * scanned in a single pass with the segmented operation, and a last kernel
+ * writes the values of the pairs to the output.
+ * When Exclusive is true, every segment starts with init, which is also
+ * combined with the values of the segment.
+ * @param sep          : Execution Policy
+ * @param keys_first   : Start of the range of keys
+ * @param keys_last    : End of the range of keys
+ * @param values_first : Start of the range of values
+ * @param result       : Start of the output range
+ * @param init         : Initial value of each segment (exclusive scan only)
+ * @param pred         : Binary predicate, returns true when two keys belong
+ *                       to the same segment
+ * @param op           : Binary operator
+ * @return  The end of the output range
+ */
+template <bool Exclusive, class ExecutionPolicy, class KeyIt, class ValueIt,
+          class OutputIt, class T, class BinaryPredicate,
+          class BinaryOperation>
+OutputIt scan_by_key(ExecutionPolicy &sep, KeyIt keys_first, KeyIt keys_last,
+                     ValueIt values_first, OutputIt result, T init,
+                     BinaryPredicate pred, BinaryOperation op) {
+  typedef typename std::iterator_traits<KeyIt>::value_type key_type;
+  typedef typename std::iterator_traits<ValueIt>::value_type value_type;
+  typedef scan_by_key_pair<value_type> pair_type;
+  typedef scan_by_key_name<typename ExecutionPolicy::kernelName> kernelName;
+  typedef std::integral_constant<bool, Exclusive> exclusive_type;
+  using PackName = cl::sycl::helpers::NameGen<0, kernelName, key_type,
+                                              value_type, exclusive_type>;
+  using UnpackName = cl::sycl::helpers::NameGen<1, kernelName, key_type,
+                                                value_type, exclusive_type>;
+  using ScanName = cl::sycl::helpers::NameGen<2, kernelName, key_type,
+                                              value_type, exclusive_type>;
+
+  cl::sycl::queue q(sep.get_queue());
+  size_t vectorSize = sycl::helpers::distance(keys_first, keys_last);
+  if (vectorSize < 1) {
+    return result;
+  }
+  auto values_last = values_first;
+  std::advance(values_last, vectorSize);
+  auto result_last = result;
+  std::advance(result_last, vectorSize);
+
+  value_type vinit = init;
+  {
+    auto keys = sycl::helpers::make_const_buffer(keys_first, keys_last);
+    auto values = sycl::helpers::make_const_buffer(values_first, values_last);
+    auto out = sycl::helpers::make_buffer(result, result_last);
+    auto pairs = sycl::helpers::make_temp_buffer<pair_type>(vectorSize);
+
+    q.submit([&](cl::sycl::handler &h) {
+      auto aK = keys.template get_access<cl::sycl::access::mode::read>(h);
+      auto aV = values.template get_access<cl::sycl::access::mode::read>(h);
+      auto aP = pairs.template get_access<cl::sycl::access::mode::write>(h);
+      h.parallel_for<PackName>(
+          cl::sycl::range<1>{vectorSize},
+          [aK, aV, aP, vinit, pred, op](cl::sycl::id<1> id) {
+            size_t pos = id[0];
+            pair_type p;
+            p.flag = (pos == 0) || !pred(aK[pos - 1], aK[pos]);
+            p.value = (Exclusive && p.flag) ? op(vinit, aV[pos]) : aV[pos];
+            aP[pos] = p;
+          });
+    });
+
+    // the first pair is always a segment head, so pinit never reaches the
+    // output
+    pair_type pinit;
+    pinit.flag = false;
+    pinit.value = vinit;
+    auto d = compute_mapscan_descriptor(q.get_device(), vectorSize,
+                                        sizeof(pair_type));
+    sycl_execution_policy<ScanName> ssep(q);
+    impl::buffer_mapscan_single_pass(
+        ssep, q, pairs, pairs, pinit, d, scan_identity<pair_type>(),
+        scan_by_key_op<value_type, BinaryOperation>{op}, Exclusive);
+
+    q.submit([&](cl::sycl::handler &h) {
+      auto aK = keys.template get_access<cl::sycl::access::mode::read>(h);
+      auto aP = pairs.template get_access<cl::sycl::access::mode::read>(h);
+      auto aO = out.template get_access<cl::sycl::access::mode::write>(h);
+      h.parallel_for<UnpackName>(
+          cl::sycl::range<1>{vectorSize},
+          [aK, aP, aO, vinit, pred](cl::sycl::id<1> id) {
+            size_t pos = id[0];
+            bool head = (pos == 0) || !pred(aK[pos - 1], aK[pos]);
+            aO[pos] = (Exclusive && head) ? vinit : aP[pos].value;
+          });
+    });
+  }
+  return result_last;
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_SCAN_BY_KEY__
@@ -0,0 +1,257 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_SEGMENTED_SORT__
+#define __SYCL_IMPL_ALGORITHM_SEGMENTED_SORT__
+
+#include <type_traits>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_device_info.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/algorithm_composite_patterns.hpp>
+#include <sycl/algorithm/sort.hpp>
+
+/** segmented_sort_name.
+ * Class used to name the segmented sort kernels per type.
+ */
+template <typename T>
+class segmented_sort_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+namespace impl {
+
+/** segmented_sort_local_size.
+ * Largest work-group size of the small segment sort: a power of two whose
+ * tile of twice its size, and the sizes of the segments packed in the tile,
+ * fit in local memory.
+ */
+template <typename T>
+size_t segmented_sort_local_size(cl::sycl::device device) {
+  const auto info = sycl::helpers::get_device_info(device);
+  const size_t maxLocal =
+      std::min(info.max_work_group_size,
+               info.local_mem_size / (2 * sizeof(T) + sizeof(size_t)));
+  size_t local = 1;
+  while (2 * local <= maxLocal) {
+    local *= 2;
+  }
+  return local;
+}
+
+/* segmented_sort_small.
+ * Sorts nbSegments segments of the buffer, starting at firstSegment in
+ * segments, in a single kernel. segments holds the start and the end of
+ * each segment, and none of these segments is longer than segmentWidth, a
+ * power of two no larger than twice the work-group size.
+ * Every work-group packs as many segments as fit in a tile of twice its
+ * size, each one padded to segmentWidth, and runs the bitonic network of
+ * segmentWidth elements on all of them at once in local memory.
+ */
+template <typename T, typename Alloc, class ComparableOperator, typename Name>
+void segmented_sort_small(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                          cl::sycl::buffer<size_t, 1> segments,
+                          size_t firstSegment, size_t nbSegments,
+                          size_t segmentWidth, size_t local,
+                          ComparableOperator comp) {
+  const size_t perGroup = 2 * local / segmentWidth;
+  const int numStages = bitonic_sort_stages(segmentWidth);
+  const cl::sycl::nd_range<1> ndRange{
+      cl::sycl::range<1>{up_rounded_division(nbSegments, perGroup) * local},
+      cl::sycl::range<1>{local}};
+  q.submit([&](cl::sycl::handler &h) {
+    auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
+    auto aS = segments.template get_access<cl::sycl::access::mode::read>(h);
+    local_rw_acc<T> tile(cl::sycl::range<1>(2 * local), h);
+    local_rw_acc<size_t> sizes(cl::sycl::range<1>(perGroup), h);
+    h.parallel_for<Name>(ndRange, [=](cl::sycl::nd_item<1> id) {
+      const size_t lid = id.get_local_id(0);
+      const size_t groupFirst = firstSegment + id.get_group(0) * perGroup;
+      const size_t groupSegments =
+          std::min(perGroup, firstSegment + nbSegments - groupFirst);
+
+      for (size_t s = lid; s < groupSegments; s += local) {
+        sizes[s] = aS[2 * (groupFirst + s) + 1] - aS[2 * (groupFirst + s)];
+      }
+      id.barrier(cl::sycl::access::fence_space::local_space);
+
+      // Slot i of the tile holds element i % segmentWidth of its segment
+      for (size_t i = lid; i < 2 * local; i += local) {
+        const size_t s = i / segmentWidth;
+        if (s < groupSegments && i % segmentWidth < sizes[s]) {
+          tile[i] = a[aS[2 * (groupFirst + s)] + i % segmentWidth];
+        }
+      }
+      id.barrier(cl::sycl::access::fence_space::local_space);
+
+      // The pairs never cross the segments, which are aligned on their
+      // width, and the padding on their right is left untouched
+      for (int stage = 0; stage < numStages; ++stage) {
+        for (int passOfStage = 0; passOfStage < stage + 1; ++passOfStage) {
+          size_t leftId, rightId;
+          bitonic_sort_pair(lid, stage, passOfStage, leftId, rightId);
+          const size_t s = rightId / segmentWidth;
+          if (s < groupSegments && rightId % segmentWidth < sizes[s]) {
+            T leftElement = tile[leftId];
+            T rightElement = tile[rightId];
+            if (comp(leftElement, rightElement)) {
+              tile[leftId] = rightElement;
+              tile[rightId] = leftElement;
+            }
+          }
+          id.barrier(cl::sycl::access::fence_space::local_space);
+        }
+      }
+
+      for (size_t i = lid; i < 2 * local; i += local) {
+        const size_t s = i / segmentWidth;
+        if (s < groupSegments && i % segmentWidth < sizes[s]) {
+          a[aS[2 * (groupFirst + s)] + i % segmentWidth] = tile[i];
+        }
+      }
+    });
+  });
+}
+
+/** segmented_sort
+ * @brief Function that sorts independently every segment of the range
+ * Segment i spans from first + offsets[i] to first + offsets[i + 1], the
+ * last one ending at last. The offsets must be increasing and no larger
+ * than the size of the range.
+ * The segments that fit in the tile of a work-group are grouped by their
+ * size rounded up to a power of two, and the segments of each group are
+ * packed in the work-groups of a single kernel. The larger ones are sorted
+ * one after the other with the bitonic sort.
+ * @param sep           : Execution Policy
+ * @param first         : Start of the range
+ * @param last          : End of the range
+ * @param offsets_first : Start of the range of segment offsets
+ * @param offsets_last  : End of the range of segment offsets
+ * @param comp          : Comp Operator, returns true when the first element
+ *                        must be placed after the second one
+ */
+template <class ExecutionPolicy, class RandomIt, class OffsetIt,
+          class ComparableOperator,
+          typename KernelName =
+              segmented_sort_name<typename ExecutionPolicy::kernelName>>
+void segmented_sort(ExecutionPolicy &sep, RandomIt first, RandomIt last,
+                    OffsetIt offsets_first, OffsetIt offsets_last,
+                    ComparableOperator comp) {
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  using SmallName = cl::sycl::helpers::NameGen<0, KernelName, type_>;
+  using LargeName = cl::sycl::helpers::NameGen<1, KernelName, type_>;
+
+  cl::sycl::queue q(sep.get_queue());
+  const size_t vectorSize = sycl::helpers::distance(first, last);
+  if (vectorSize < 2) {
+    return;
+  }
+  const size_t local = segmented_sort_local_size<type_>(q.get_device());
+  const int maxStages = bitonic_sort_stages(2 * local);
+
+  // Start and end of the small segments, bucketed by the number of stages
+  // of their bitonic network, and of the large ones
+  const std::vector<size_t> offsets(offsets_first, offsets_last);
+  std::vector<std::vector<size_t>> buckets(maxStages + 1);
+  std::vector<size_t> large;
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    const size_t begin = offsets[i];
+    const size_t end = (i + 1 < offsets.size()) ? offsets[i + 1] : vectorSize;
+    if (end - begin < 2) {
+      continue;
+    }
+    auto &segments = (end - begin <= 2 * local)
+                         ? buckets[bitonic_sort_stages(end - begin)]
+                         : large;
+    segments.push_back(begin);
+    segments.push_back(end);
+  }
+  std::vector<size_t> small;
+  for (const auto &bucket : buckets) {
+    small.insert(small.end(), bucket.begin(), bucket.end());
+  }
+
+  auto buf = sycl::helpers::make_buffer(first, last);
+  typedef typename buffer_traits<decltype(buf)>::allocator_type alloc_;
+  if (!small.empty()) {
+    const size_t *smallData = small.data();
+    cl::sycl::buffer<size_t, 1> segments(smallData,
+                                         cl::sycl::range<1>(small.size()));
+    size_t firstSegment = 0;
+    for (int stages = 1; stages <= maxStages; ++stages) {
+      const size_t nbSegments = buckets[stages].size() / 2;
+      if (nbSegments == 0) {
+        continue;
+      }
+      // The work-groups are no larger than the segments of the bucket need
+      const size_t segmentWidth = size_t(1) << stages;
+      size_t groupSize = segmentWidth / 2;
+      while (groupSize < local && 2 * groupSize < nbSegments * segmentWidth) {
+        groupSize *= 2;
+      }
+      segmented_sort_small<type_, alloc_, ComparableOperator, SmallName>(
+          q, buf, segments, firstSegment, nbSegments, segmentWidth, groupSize,
+          comp);
+      firstSegment += nbSegments;
+    }
+  }
+  for (size_t i = 0; i < large.size(); i += 2) {
+    bitonic_sort<type_, alloc_, ComparableOperator, LargeName>(
+        q, buf, large[i], large[i + 1] - large[i], comp);
+  }
+}
+
+/** segmented_sort
+ * @brief Function that sorts independently every segment of the range in
+ * increasing order
+ * @param sep           : Execution Policy
+ * @param first         : Start of the range
+ * @param last          : End of the range
+ * @param offsets_first : Start of the range of segment offsets
+ * @param offsets_last  : End of the range of segment offsets
+ */
+template <class ExecutionPolicy, class RandomIt, class OffsetIt>
+void segmented_sort(ExecutionPolicy &sep, RandomIt first, RandomIt last,
+                    OffsetIt offsets_first, OffsetIt offsets_last) {
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  typedef typename ExecutionPolicy::kernelName kernelName;
+  segmented_sort<ExecutionPolicy, RandomIt, OffsetIt, sort_greater<type_>,
+                 segmented_sort_name<sort_greater<kernelName>>>(
+      sep, first, last, offsets_first, offsets_last, sort_greater<type_>());
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_SEGMENTED_SORT__
@@ -32,6 +32,14 @@
 #include <type_traits>
 #include <typeinfo>
 #include <algorithm>
+#include <cstdint>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_device_info.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/algorithm_composite_patterns.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
 
 /** sort_kernel_bitonic.
  * Class used to name the bitonic kernel sort per type.
@@ -55,6 +63,14 @@ class bitonic_sort_name {
   T userGivenKernelName;
 };
 
+/** radix_sort_name.
+ * Class used to name the radix sort kernels per type.
+ */
+template <typename T>
+class radix_sort_name {
+  T userGivenKernelName;
+};
+
 /* sort_swap.
  * Basic simple swap used inside the sort functions.
  */
@@ -76,16 +92,17 @@ class sort_kernel_sequential {
                          cl::sycl::access::target::global_buffer>;
 
   sycl_rw_acc a_;
+  size_t first_;
   size_t vS_;
 
  public:
-  sort_kernel_sequential(sycl_rw_acc a, size_t vectorSize)
-      : a_(a), vS_(vectorSize){};
+  sort_kernel_sequential(sycl_rw_acc a, size_t first, size_t vectorSize)
+      : a_(a), first_(first), vS_(vectorSize){};
 
   // Simple sequential sort
   void operator()() {
     for (size_t i = 0; i < vS_; i++) {
-      for (size_t j = 1; j < vS_; j++) {
+      for (size_t j = first_ + 1; j < first_ + vS_; j++) {
         if (a_[j - 1] > a_[j]) {
           sort_swap<T>(a_[j - 1], a_[j]);
         }
@@ -105,18 +122,19 @@ class sort_kernel_sequential_comp {
                          cl::sycl::access::target::global_buffer>;
 
   sycl_rw_acc a_;
+  size_t first_;
   size_t vS_;
   ComparableOperator comp_;
 
  public:
-  sort_kernel_sequential_comp(sycl_rw_acc a, size_t vectorSize,
+  sort_kernel_sequential_comp(sycl_rw_acc a, size_t first, size_t vectorSize,
                               ComparableOperator comp)
-      : a_(a), vS_(vectorSize), comp_(comp){};
+      : a_(a), first_(first), vS_(vectorSize), comp_(comp){};
 
   // Simple sequential sort
   void operator()() {
     for (size_t i = 0; i < vS_; i++) {
-      for (size_t j = 1; j < vS_; j++) {
+      for (size_t j = first_ + 1; j < first_ + vS_; j++) {
         if (comp_(a_[j - 1], a_[j])) {
           sort_swap<T>(a_[j - 1], a_[j]);
         }
@@ -126,6 +144,10 @@ class sort_kernel_sequential_comp {
 };  // class sort_kernel
 
 namespace sycl {
+
+template <class KernelName>
+class sycl_execution_policy;
+
 namespace impl {
 
 /* Aliases for SYCL accessors */
@@ -149,151 +171,493 @@ template <>
 inline bool isPowerOfTwo<double>(double num) = delete;
 
 /** sequential_sort.
- * Command group to call the sequential sort kernel */
+ * Command group to call the sequential sort kernel on the vectorSize
+ * elements of the buffer starting at first */
 template <typename T, typename Alloc>
 void sequential_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
-                     size_t vectorSize) {
-  auto f = [buf, vectorSize](cl::sycl::handler &h) mutable {
+                     size_t first, size_t vectorSize) {
+  auto f = [buf, first, vectorSize](cl::sycl::handler &h) mutable {
     auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
-    h.single_task(sort_kernel_sequential<T>(a, vectorSize));
+    h.single_task(sort_kernel_sequential<T>(a, first, vectorSize));
   };
   q.submit(f);
 }
 
 /** sequential_sort.
  * Command group to call the sequential sort kernel */
+template <typename T, typename Alloc>
+void sequential_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                     size_t vectorSize) {
+  sequential_sort<T>(q, buf, 0, vectorSize);
+}
+
+/** sequential_sort.
+ * Command group to call the sequential sort kernel on the vectorSize
+ * elements of the buffer starting at first */
 template <typename T, typename Alloc, class ComparableOperator, typename Name>
 void sequential_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
-                     size_t vectorSize, ComparableOperator comp) {
-  auto f = [buf, vectorSize, comp](cl::sycl::handler &h) mutable {
+                     size_t first, size_t vectorSize,
+                     ComparableOperator comp) {
+  auto f = [buf, first, vectorSize, comp](cl::sycl::handler &h) mutable {
     auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
     h.single_task<Name>(sort_kernel_sequential_comp<T, ComparableOperator>(
-        a, vectorSize, comp));
+        a, first, vectorSize, comp));
   };
   q.submit(f);
 }
 
-/* bitonic_sort.
- * Performs a bitonic sort on the given buffer
+/** sequential_sort.
+ * Command group to call the sequential sort kernel */
+template <typename T, typename Alloc, class ComparableOperator, typename Name>
+void sequential_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                     size_t vectorSize, ComparableOperator comp) {
+  sequential_sort<T, Alloc, ComparableOperator, Name>(q, buf, 0, vectorSize,
+                                                      comp);
+}
+
+/** sequential_sort_threshold.
+ * Ranges up to this size are sorted by a single work-item, as the kernel
+ * submissions of the bitonic network cost more than the sort itself.
  */
-template <typename T, typename Alloc>
-void bitonic_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
-                  size_t vectorSize) {
+constexpr size_t sequential_sort_threshold = 16;
+
+/** sort_greater.
+ * Default comparison of the bitonic sort, returns true when the pair
+ * needs to be swapped.
+ */
+template <typename T>
+struct sort_greater {
+  bool operator()(const T &lhs, const T &rhs) const { return lhs > rhs; }
+};
+
+/** bitonic_sort_stages.
+ * Number of stages of the bitonic network for the given size, i.e. the
+ * log2 of the size rounded up to the next power of two.
+ */
+inline int bitonic_sort_stages(size_t vectorSize) {
   int numStages = 0;
-  // 2^numStages should be equal to length
-  // i.e number of times you halve the lenght to get 1 should be numStages
-  for (int tmp = vectorSize; tmp > 1; tmp >>= 1) {
+  for (size_t tmp = 1; tmp < vectorSize; tmp <<= 1) {
     ++numStages;
   }
-  cl::sycl::range<1> r{vectorSize / 2};
-  for (int stage = 0; stage < numStages; ++stage) {
-    // Every stage has stage + 1 passes
-    for (int passOfStage = 0; passOfStage < stage + 1; ++passOfStage) {
-      auto f = [=](cl::sycl::handler &h) mutable {
-        auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
-        h.parallel_for<sort_kernel_bitonic<T>>(
-            cl::sycl::range<1>{r},
-            [a, stage, passOfStage](cl::sycl::item<1> it) {
-              int sortIncreasing = 1;
-              cl::sycl::id<1> id = it.get_id();
-              int threadId = id.get(0);
-
-              int pairDistance = 1 << (stage - passOfStage);
-              int blockWidth = 2 * pairDistance;
-
-              int leftId = (threadId % pairDistance) +
-                           (threadId / pairDistance) * blockWidth;
-              int rightId = leftId + pairDistance;
-
-              T leftElement = a[leftId];
-              T rightElement = a[rightId];
+  return numStages;
+}
 
-              int sameDirectionBlockWidth = 1 << stage;
+/** bitonic_sort_pair.
+ * Indices of the pair compared by the given work-item during a pass.
+ * The first pass of a stage merges two sorted halves, hence it compares
+ * each element with its mirror in the block.
+ */
+inline void bitonic_sort_pair(size_t threadId, int stage, int passOfStage,
+                              size_t &leftId, size_t &rightId) {
+  size_t pairDistance = size_t(1) << (stage - passOfStage);
+  size_t blockWidth = 2 * pairDistance;
+  size_t offset = threadId % pairDistance;
+
+  leftId = offset + (threadId / pairDistance) * blockWidth;
+  rightId = (passOfStage == 0) ? leftId - offset + blockWidth - 1 - offset
+                               : leftId + pairDistance;
+}
 
-              if ((threadId / sameDirectionBlockWidth) % 2 == 1) {
-                sortIncreasing = 1 - sortIncreasing;
-              }
+/* bitonic_sort_local.
+ * Runs the passes of the bitonic network from (firstStage, firstPass) to the
+ * end of lastStage in local memory, on the vectorSize elements of the buffer
+ * starting at first. Every work-group loads a tile of twice its size, hence
+ * all these passes must have a pair distance no larger than the work-group
+ * size.
+ */
+template <typename T, typename Alloc, class ComparableOperator, typename Name>
+void bitonic_sort_local(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                        size_t first, size_t vectorSize,
+                        ComparableOperator comp,
+                        cl::sycl::nd_range<1> ndRange, int firstStage,
+                        int firstPass, int lastStage) {
+  using LocalName = cl::sycl::helpers::NameGen<1, Name>;
+  const size_t local = ndRange.get_local()[0];
+  auto f = [=](cl::sycl::handler &h) mutable {
+    auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
+    local_rw_acc<T> tile(cl::sycl::range<1>(2 * local), h);
+    h.parallel_for<LocalName>(ndRange, [=](cl::sycl::nd_item<1> id) {
+      const size_t lid = id.get_local_id(0);
+      const size_t tileBase = id.get_group(0) * 2 * local;
+
+      for (size_t i = lid; i < 2 * local; i += local) {
+        if (tileBase + i < vectorSize) {
+          tile[i] = a[first + tileBase + i];
+        }
+      }
+      id.barrier(cl::sycl::access::fence_space::local_space);
+
+      for (int stage = firstStage; stage <= lastStage; ++stage) {
+        int passOfStage = (stage == firstStage) ? firstPass : 0;
+        for (; passOfStage < stage + 1; ++passOfStage) {
+          size_t leftId, rightId;
+          bitonic_sort_pair(lid, stage, passOfStage, leftId, rightId);
+          if (tileBase + rightId < vectorSize) {
+            T leftElement = tile[leftId];
+            T rightElement = tile[rightId];
+            if (comp(leftElement, rightElement)) {
+              tile[leftId] = rightElement;
+              tile[rightId] = leftElement;
+            }
+          }
+          id.barrier(cl::sycl::access::fence_space::local_space);
+        }
+      }
 
-              T greater;
-              T lesser;
+      for (size_t i = lid; i < 2 * local; i += local) {
+        if (tileBase + i < vectorSize) {
+          a[first + tileBase + i] = tile[i];
+        }
+      }
+    });
+  };  // command group functor
+  q.submit(f);
+}
 
-              if (leftElement > rightElement) {
-                greater = leftElement;
-                lesser = rightElement;
-              } else {
-                greater = rightElement;
-                lesser = leftElement;
+/* bitonic_sort.
+ * Performs a bitonic sort on the given buffer.
+ * The network sorts every block in increasing order: the first pass of each
+ * stage compares mirrored elements of the block instead of reversing the
+ * direction of every other block. This way the range is implicitly padded to
+ * the next power of two with elements that compare greater than any other,
+ * and any pair whose right element lies outside the range is left untouched,
+ * so the sort works for any size.
+ * Every work-group sorts a tile of twice its size in local memory, then for
+ * each of the following stages only the passes whose pair distance exceeds
+ * the work-group size run on global memory, and the remaining passes of the
+ * stage run in a single kernel on local memory.
+ * Only the vectorSize elements of the buffer starting at first are sorted.
+ */
+template <typename T, typename Alloc, class ComparableOperator, typename Name>
+void bitonic_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                  size_t first, size_t vectorSize, ComparableOperator comp) {
+  int numStages = bitonic_sort_stages(vectorSize);
+  if (numStages == 0) {
+    return;
+  }
+  // one work-item per pair of the padded range
+  cl::sycl::range<1> r{(size_t(1) << numStages) / 2};
+
+  // The work-group size is a power of two, so the tiles match the blocks of
+  // the network, and each tile of 2 * local elements must fit in local memory
+  const auto device = sycl::helpers::get_device_info(q.get_device());
+  size_t maxLocal = std::min(device.max_work_group_size,
+                             device.local_mem_size / (2 * sizeof(T)));
+  maxLocal = std::min(maxLocal, r[0]);
+  int localStages = 0;
+  while ((size_t(1) << (localStages + 1)) <= maxLocal) {
+    ++localStages;
+  }
+  const size_t local = size_t(1) << localStages;
+  const cl::sycl::nd_range<1> ndRange{r, cl::sycl::range<1>{local}};
+  // Stages whose blocks fit in a tile
+  const int tileStages = std::min(localStages + 1, numStages);
+
+  bitonic_sort_local<T, Alloc, ComparableOperator, Name>(
+      q, buf, first, vectorSize, comp, ndRange, 0, 0, tileStages - 1);
+
+  for (int stage = tileStages; stage < numStages; ++stage) {
+    // The passes with a pair distance larger than the work-group size
+    const int globalPasses = stage - localStages;
+    for (int passOfStage = 0; passOfStage < globalPasses; ++passOfStage) {
+      auto f = [=](cl::sycl::handler &h) mutable {
+        auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
+        h.parallel_for<Name>(
+            cl::sycl::range<1>{r},
+            [a, stage, passOfStage, first, vectorSize,
+             comp](cl::sycl::item<1> it) {
+              size_t leftId, rightId;
+              bitonic_sort_pair(it.get_id(0), stage, passOfStage, leftId,
+                                rightId);
+
+              if (rightId < vectorSize) {
+                T leftElement = a[first + leftId];
+                T rightElement = a[first + rightId];
+                if (comp(leftElement, rightElement)) {
+                  a[first + leftId] = rightElement;
+                  a[first + rightId] = leftElement;
+                }
               }
-
-              a[leftId] = sortIncreasing ? lesser : greater;
-              a[rightId] = sortIncreasing ? greater : lesser;
             });
       };  // command group functor
       q.submit(f);
     }  // passStage
-  }    // stage
+    bitonic_sort_local<T, Alloc, ComparableOperator, Name>(
+        q, buf, first, vectorSize, comp, ndRange, stage, globalPasses, stage);
+  }  // stage
 }  // bitonic_sort
 
 /* bitonic_sort.
- * Performs a bitonic sort on the given buffer
+ * Performs a bitonic sort on the whole buffer
  */
 template <typename T, typename Alloc, class ComparableOperator, typename Name>
 void bitonic_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
                   size_t vectorSize, ComparableOperator comp) {
-  int numStages = 0;
-  // 2^numStages should be equal to length
-  // i.e number of times you halve the lenght to get 1 should be numStages
-  for (int tmp = vectorSize; tmp > 1; tmp >>= 1) {
-    ++numStages;
-  }
-  cl::sycl::range<1> r{vectorSize / 2};
-  for (int stage = 0; stage < numStages; ++stage) {
-    // Every stage has stage + 1 passes
-    for (int passOfStage = 0; passOfStage < stage + 1; ++passOfStage) {
-      auto f = [=](cl::sycl::handler &h) mutable {
-        auto a = buf.template get_access<cl::sycl::access::mode::read_write>(h);
-        h.parallel_for<Name>(
-            cl::sycl::range<1>{r},
-            [a, stage, passOfStage, comp](cl::sycl::item<1> it) {
-              int sortIncreasing = 1;
-              cl::sycl::id<1> id = it.get_id();
-              int threadId = id.get(0);
+  bitonic_sort<T, Alloc, ComparableOperator, Name>(q, buf, 0, vectorSize,
+                                                   comp);
+}
 
-              int pairDistance = 1 << (stage - passOfStage);
-              int blockWidth = 2 * pairDistance;
+/* bitonic_sort.
+ * Performs a bitonic sort on the vectorSize elements of the given buffer
+ * starting at first
+ */
+template <typename T, typename Alloc>
+void bitonic_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                  size_t first, size_t vectorSize) {
+  bitonic_sort<T, Alloc, sort_greater<T>, sort_kernel_bitonic<T>>(
+      q, buf, first, vectorSize, sort_greater<T>());
+}
 
-              int leftId = (threadId % pairDistance) +
-                           (threadId / pairDistance) * blockWidth;
-              int rightId = leftId + pairDistance;
+/* bitonic_sort.
+ * Performs a bitonic sort on the given buffer
+ */
+template <typename T, typename Alloc>
+void bitonic_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                  size_t vectorSize) {
+  bitonic_sort<T>(q, buf, 0, vectorSize);
+}
 
-              T leftElement = a[leftId];
-              T rightElement = a[rightId];
+/** radix_sort_bits.
+ * Number of bits of the key sorted by each pass of the radix sort.
+ */
+constexpr int radix_sort_bits = 4;
+constexpr size_t radix_sort_radix = size_t(1) << radix_sort_bits;
 
-              int sameDirectionBlockWidth = 1 << stage;
+/** radix_key_bits.
+ * Unsigned integer type with the same size as the key.
+ */
+template <size_t Size>
+struct radix_key_bits;
 
-              if ((threadId / sameDirectionBlockWidth) % 2 == 1) {
-                sortIncreasing = 1 - sortIncreasing;
-              }
+template <>
+struct radix_key_bits<1> {
+  typedef std::uint8_t type;
+};
 
-              T greater;
-              T lesser;
+template <>
+struct radix_key_bits<2> {
+  typedef std::uint16_t type;
+};
 
-              if (comp(leftElement, rightElement)) {
-                greater = leftElement;
-                lesser = rightElement;
-              } else {
-                greater = rightElement;
-                lesser = leftElement;
-              }
+template <>
+struct radix_key_bits<4> {
+  typedef std::uint32_t type;
+};
 
-              a[leftId] = sortIncreasing ? lesser : greater;
-              a[rightId] = sortIncreasing ? greater : lesser;
-            });
-      };  // command group functor
-      q.submit(f);
-    }  // passStage
-  }    // stage
-}  // bitonic_sort
+template <>
+struct radix_key_bits<8> {
+  typedef std::uint64_t type;
+};
+
+/** radix_key.
+ * Maps a key to an unsigned integer whose ordering matches the ordering of
+ * the key, so the radix sort can work on the bits directly.
+ * Unsigned integers are used as they are.
+ */
+template <typename T, typename Enable = void>
+struct radix_key {
+  typedef typename radix_key_bits<sizeof(T)>::type bits_type;
+
+  static bits_type to_bits(T key) { return static_cast<bits_type>(key); }
+};
+
+/** radix_key.
+ * Signed integers have their sign bit flipped, so negative values come
+ * before positive ones.
+ */
+template <typename T>
+struct radix_key<T, typename std::enable_if<std::is_integral<T>::value &&
+                                            std::is_signed<T>::value>::type> {
+  typedef typename radix_key_bits<sizeof(T)>::type bits_type;
+
+  static bits_type to_bits(T key) {
+    return static_cast<bits_type>(key) ^
+           (bits_type(1) << (sizeof(bits_type) * 8 - 1));
+  }
+};
+
+/** radix_key.
+ * Floating point values have their sign bit flipped when positive, and all
+ * their bits flipped when negative, which orders them as integers.
+ */
+template <typename T>
+struct radix_key<T, typename std::enable_if<
+                        std::is_floating_point<T>::value>::type> {
+  typedef typename radix_key_bits<sizeof(T)>::type bits_type;
+
+  static bits_type to_bits(T key) {
+    union {
+      T value;
+      bits_type bits;
+    } u;
+    u.value = key;
+    const bits_type sign = bits_type(1) << (sizeof(bits_type) * 8 - 1);
+    return (u.bits & sign) ? bits_type(~u.bits) : bits_type(u.bits | sign);
+  }
+};
+
+/** is_radix_sortable.
+ * Arithmetic types (other than bool) sorted with the default comparison
+ * can be sorted by the radix sort.
+ */
+template <typename T>
+struct is_radix_sortable
+    : std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                       !std::is_same<T, bool>::value &&
+                                       (sizeof(T) == 1 || sizeof(T) == 2 ||
+                                        sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+/** radix_digit.
+ * Digit of the key for the pass that starts at bit shift.
+ */
+template <typename T>
+inline size_t radix_digit(T key, int shift) {
+  return static_cast<size_t>((radix_key<T>::to_bits(key) >> shift) &
+                             (radix_sort_radix - 1));
+}
+
+/* radix_sort.
+ * Performs a least significant digit radix sort on the given buffer.
+ * Each pass sorts radix_sort_bits bits of the key:
+ *  - every work-group sorts its tile by the digit in local memory and counts
+ *    the number of elements per digit,
+ *  - the counts, stored digit-major, are scanned with buffer_mapscan, which
+ *    gives the position of every (digit, work-group) bucket in the output,
+ *  - every work-group scatters its locally sorted tile to its buckets.
+ * The local sort and the scatter are stable, hence the whole sort is.
+ * Only the vectorSize elements of the buffer starting at first are sorted.
+ */
+template <typename ExecutionPolicy, typename T, typename Alloc>
+void radix_sort(ExecutionPolicy &sep, cl::sycl::queue q,
+                cl::sycl::buffer<T, 1, Alloc> buf, size_t first,
+                size_t vectorSize) {
+  using KernelName = radix_sort_name<typename ExecutionPolicy::kernelName>;
+  using LocalSortName = cl::sycl::helpers::NameGen<0, KernelName, T>;
+  using ScatterName = cl::sycl::helpers::NameGen<1, KernelName, T>;
+  using ScanName = cl::sycl::helpers::NameGen<2, KernelName, T>;
+
+  const auto device = sycl::helpers::get_device_info(q.get_device());
+  // The keys, digits and scan of the tile, plus the starts and sizes of the
+  // digits, must fit in local memory
+  const size_t maxLocal =
+      (device.local_mem_size - 2 * radix_sort_radix * sizeof(size_t)) /
+      (sizeof(T) + 2 * sizeof(size_t));
+  const size_t local = std::min(
+      vectorSize, std::min(device.max_work_group_size, maxLocal));
+  const size_t nbWorkGroup = up_rounded_division(vectorSize, local);
+  const size_t nbBuckets = radix_sort_radix * nbWorkGroup;
+  const cl::sycl::nd_range<1> ndRange{
+      cl::sycl::range<1>{nbWorkGroup * local}, cl::sycl::range<1>{local}};
+
+  auto tiles = sycl::helpers::make_temp_buffer<T>(vectorSize);
+  auto counts = sycl::helpers::make_temp_buffer<size_t>(nbBuckets);
+  auto offsets = sycl::helpers::make_temp_buffer<size_t>(nbBuckets);
+
+  sycl_execution_policy<ScanName> scan_sep(q);
+  const auto scanDescriptor =
+      compute_mapscan_descriptor(device, nbBuckets, sizeof(size_t));
+
+  for (int shift = 0; shift < static_cast<int>(sizeof(T) * 8);
+       shift += radix_sort_bits) {
+    // Local sort of every tile by the current digit
+    q.submit([&](cl::sycl::handler &h) {
+      auto a = buf.template get_access<cl::sycl::access::mode::read>(h);
+      auto aT = tiles.template get_access<cl::sycl::access::mode::write>(h);
+      auto aC = counts.template get_access<cl::sycl::access::mode::write>(h);
+      local_rw_acc<T> keys(cl::sycl::range<1>(local), h);
+      local_rw_acc<size_t> digits(cl::sycl::range<1>(local), h);
+      local_rw_acc<size_t> scan(cl::sycl::range<1>(local), h);
+      local_rw_acc<size_t> starts(cl::sycl::range<1>(radix_sort_radix), h);
+      local_rw_acc<size_t> sizes(cl::sycl::range<1>(radix_sort_radix), h);
+      h.parallel_for<LocalSortName>(ndRange, [=](cl::sycl::nd_item<1> id) {
+        const size_t lid = id.get_local_id(0);
+        const size_t group = id.get_group(0);
+        const size_t gid = group * local + lid;
+        const size_t tileSize = std::min(local, vectorSize - group * local);
+
+        // Work-items past the end of the range take the largest digit, so
+        // they stay at the end of the tile
+        T key = (gid < vectorSize) ? a[first + gid] : T();
+        size_t digit = (gid < vectorSize) ? radix_digit(key, shift)
+                                          : radix_sort_radix - 1;
+
+        // Stable split of the tile on every bit of the digit
+        for (int bit = 0; bit < radix_sort_bits; ++bit) {
+          const size_t isZero = ((digit >> bit) & 1) ? 0 : 1;
+          scan[lid] = isZero;
+          id.barrier(cl::sycl::access::fence_space::local_space);
+          for (size_t offset = 1; offset < local; offset <<= 1) {
+            const size_t value = (lid >= offset) ? scan[lid - offset] : 0;
+            id.barrier(cl::sycl::access::fence_space::local_space);
+            scan[lid] += value;
+            id.barrier(cl::sycl::access::fence_space::local_space);
+          }
+          const size_t zerosBefore = scan[lid] - isZero;
+          const size_t totalZeros = scan[local - 1];
+          const size_t pos =
+              isZero ? zerosBefore : totalZeros + lid - zerosBefore;
+          keys[pos] = key;
+          digits[pos] = digit;
+          id.barrier(cl::sycl::access::fence_space::local_space);
+          key = keys[lid];
+          digit = digits[lid];
+          id.barrier(cl::sycl::access::fence_space::local_space);
+        }
+
+        // Count the elements of each digit in the tile
+        for (size_t r = lid; r < radix_sort_radix; r += local) {
+          sizes[r] = 0;
+        }
+        id.barrier(cl::sycl::access::fence_space::local_space);
+        if (lid < tileSize && (lid == 0 || digits[lid - 1] != digit)) {
+          starts[digit] = lid;
+        }
+        id.barrier(cl::sycl::access::fence_space::local_space);
+        if (lid < tileSize &&
+            (lid == tileSize - 1 || digits[lid + 1] != digit)) {
+          sizes[digit] = lid - starts[digit] + 1;
+        }
+        id.barrier(cl::sycl::access::fence_space::local_space);
+
+        for (size_t r = lid; r < radix_sort_radix; r += local) {
+          aC[r * nbWorkGroup + group] = sizes[r];
+        }
+        if (lid < tileSize) {
+          aT[gid] = key;
+        }
+      });
+    });
+
+    // Position of every bucket in the output
+    impl::buffer_mapscan(scan_sep, q, counts, offsets, size_t(0),
+                         scanDescriptor, [](size_t x) { return x; },
+                         [](size_t x, size_t y) { return x + y; });
+
+    // Scatter of the sorted tiles to their buckets
+    q.submit([&](cl::sycl::handler &h) {
+      auto a = buf.template get_access<cl::sycl::access::mode::write>(h);
+      auto aT = tiles.template get_access<cl::sycl::access::mode::read>(h);
+      auto aC = counts.template get_access<cl::sycl::access::mode::read>(h);
+      auto aO = offsets.template get_access<cl::sycl::access::mode::read>(h);
+      h.parallel_for<ScatterName>(ndRange, [=](cl::sycl::nd_item<1> id) {
+        const size_t lid = id.get_local_id(0);
+        const size_t group = id.get_group(0);
+        const size_t gid = group * local + lid;
+        if (gid < vectorSize) {
+          const T key = aT[gid];
+          const size_t digit = radix_digit(key, shift);
+          size_t tileStart = 0;
+          for (size_t r = 0; r < digit; ++r) {
+            tileStart += aC[r * nbWorkGroup + group];
+          }
+          const size_t bucket = digit * nbWorkGroup + group;
+          // offsets holds the inclusive scan of the counts
+          a[first + aO[bucket] - aC[bucket] + lid - tileStart] = key;
+        }
+      });
+    });
+  }
+}
 
 template<typename T>
 struct buffer_traits;
@@ -303,6 +667,106 @@ struct buffer_traits<cl::sycl::buffer<T, 1, Alloc>> {
   typedef Alloc allocator_type;
 };
 
+template<typename T>
+struct buffer_traits<sycl::helpers::temp_buffer<T>>
+    : buffer_traits<cl::sycl::buffer<T, 1>> {};
+
+template<typename T, typename Alloc>
+struct buffer_traits<sycl::helpers::range_buffer<T, Alloc>>
+    : buffer_traits<cl::sycl::buffer<T, 1, Alloc>> {};
+
+/** SortImpl.
+ * Selects the sort used when no comparison is given: the radix sort for
+ * arithmetic types, the bitonic sort otherwise.
+ */
+template <bool UseRadix>
+struct SortImpl;
+
+template <>
+struct SortImpl<true> {
+  template <class ExecutionPolicy, typename T, typename Alloc>
+  static void sort(ExecutionPolicy &sep, cl::sycl::queue q,
+                   cl::sycl::buffer<T, 1, Alloc> buf, size_t first,
+                   size_t vectorSize) {
+    radix_sort(sep, q, buf, first, vectorSize);
+  }
+};
+
+template <>
+struct SortImpl<false> {
+  template <class ExecutionPolicy, typename T, typename Alloc>
+  static void sort(ExecutionPolicy &sep, cl::sycl::queue q,
+                   cl::sycl::buffer<T, 1, Alloc> buf, size_t first,
+                   size_t vectorSize) {
+    bitonic_sort<T>(q, buf, first, vectorSize);
+  }
+};
+
+/** buffer_sort
+ * @brief Function that sorts [first, first + vectorSize) in the buffer
+ * @param sep        : Execution Policy
+ * @param q          : Queue
+ * @param buf        : Buffer to sort
+ * @param first      : Offset of the range in the buffer
+ * @param vectorSize : Size of the range
+ */
+template <class ExecutionPolicy, typename T, typename Alloc>
+void buffer_sort(ExecutionPolicy &sep, cl::sycl::queue q,
+                 cl::sycl::buffer<T, 1, Alloc> buf, size_t first,
+                 size_t vectorSize) {
+  if (vectorSize > sequential_sort_threshold) {
+    SortImpl<is_radix_sortable<T>::value>::sort(sep, q, buf, first,
+                                                vectorSize);
+  } else {
+    sycl::impl::sequential_sort<T>(q, buf, first, vectorSize);
+  }
+}
+
+/** buffer_sort
+ * @brief Function that sorts [first, first + vectorSize) in the buffer
+ * with the given Comp Operator
+ * @param sep        : Execution Policy
+ * @param q          : Queue
+ * @param buf        : Buffer to sort
+ * @param first      : Offset of the range in the buffer
+ * @param vectorSize : Size of the range
+ * @param comp       : Comp Operator
+ */
+template <class ExecutionPolicy, typename T, typename Alloc,
+          class CompareOp>
+void buffer_sort(ExecutionPolicy &sep, cl::sycl::queue q,
+                 cl::sycl::buffer<T, 1, Alloc> buf, size_t first,
+                 size_t vectorSize, CompareOp comp) {
+  if (vectorSize > sequential_sort_threshold) {
+    sycl::impl::bitonic_sort<
+        T, Alloc, CompareOp,
+        bitonic_sort_name<typename ExecutionPolicy::kernelName>>(
+        q, buf, first, vectorSize, comp);
+  } else {
+    sycl::impl::sequential_sort<
+        T, Alloc, CompareOp,
+        sequential_sort_name<typename ExecutionPolicy::kernelName>>(
+        q, buf, first, vectorSize, comp);
+  }
+}
+
+/** sort
+ * @brief Function that sorts the given range
+ * For SYCL iterators the range is sorted in place in the underlying buffer.
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param last  : End of the range
+ */
+template <class ExecutionPolicy, class RandomIt>
+void sort(ExecutionPolicy &sep, RandomIt first, RandomIt last) {
+  cl::sycl::queue q(sep.get_queue());
+  size_t offset;
+  auto buf =
+      std::move(sycl::helpers::make_inplace_buffer(first, last, offset));
+  auto vectorSize = sycl::helpers::distance(first, last);
+  buffer_sort(sep, q, buf, offset, vectorSize);
+}
+
 /** sort
  * @brief Function that takes a Comp Operator and applies it to the given range
  * @param sep   : Execution Policy
@@ -313,23 +777,11 @@ struct buffer_traits<cl::sycl::buffer<T, 1, Alloc>> {
 template <class ExecutionPolicy, class RandomIt, class CompareOp>
 void sort(ExecutionPolicy &sep, RandomIt first, RandomIt last, CompareOp comp) {
   cl::sycl::queue q(sep.get_queue());
-  typedef typename std::iterator_traits<RandomIt>::value_type type_;
-  auto buf = std::move(sycl::helpers::make_buffer(first, last));
-  auto vectorSize = buf.get_count();
-
-  typedef typename buffer_traits<decltype(buf)>::allocator_type allocator_;
-  
-  if (impl::isPowerOfTwo(vectorSize)) {
-    sycl::impl::bitonic_sort<
-        type_, allocator_, CompareOp,
-        bitonic_sort_name<typename ExecutionPolicy::kernelName>>(
-        q, buf, vectorSize, comp);
-  } else {
-    sycl::impl::sequential_sort<
-        type_, allocator_, CompareOp,
-        sequential_sort_name<typename ExecutionPolicy::kernelName>>(
-        q, buf, vectorSize, comp);
-  }
+  size_t offset;
+  auto buf =
+      std::move(sycl::helpers::make_inplace_buffer(first, last, offset));
+  auto vectorSize = sycl::helpers::distance(first, last);
+  buffer_sort(sep, q, buf, offset, vectorSize, comp);
 }
 
 }  // namespace impl
@@ -0,0 +1,183 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_SORT_BY_KEY__
+#define __SYCL_IMPL_ALGORITHM_SORT_BY_KEY__
+
+#include <type_traits>
+#include <algorithm>
+#include <iterator>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/sort.hpp>
+
+/** sort_by_key_name.
+ * Class used to name the sort by key kernels per type.
+ */
+template <typename T>
+class sort_by_key_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+namespace impl {
+
+/** key_index_pair.
+ * Key to sort together with the position of its value in the input, so
+ * only the key and the index move during the sort.
+ */
+template <typename Key>
+struct key_index_pair {
+  Key key;
+  size_t index;
+};
+
+/** key_index_comp.
+ * Compares two key_index_pair with the user comparison on the keys.
+ * When Stable is true, equivalent keys are ordered by their index.
+ * As for sort, the comparison returns true when lhs must be placed
+ * after rhs.
+ */
+template <typename Key, class ComparableOperator, bool Stable>
+struct key_index_comp {
+  ComparableOperator comp;
+
+  bool operator()(const key_index_pair<Key> &lhs,
+                  const key_index_pair<Key> &rhs) const {
+    if (!Stable) {
+      return comp(lhs.key, rhs.key);
+    }
+    if (comp(lhs.key, rhs.key) && !comp(rhs.key, lhs.key)) {
+      return true;
+    }
+    if (comp(rhs.key, lhs.key) && !comp(lhs.key, rhs.key)) {
+      return false;
+    }
+    return lhs.index > rhs.index;
+  }
+};
+
+/* sort_by_key.
+ * @brief Sorts the keys in [keys_first, keys_last) and applies the same
+ * permutation to the values starting at values_first.
+ * The keys and the values stay in separate buffers: the keys are sorted
+ * together with their index, then the values are gathered once.
+ * @param sep          : Execution Policy
+ * @param keys_first   : Start of the range of keys
+ * @param keys_last    : End of the range of keys
+ * @param values_first : Start of the range of values
+ * @param comp         : Comp Operator, returns true when the first key must
+ *                       be placed after the second one
+ */
+template <bool Stable, class ExecutionPolicy, class KeyIt, class ValueIt,
+          class ComparableOperator,
+          typename KernelName =
+              sort_by_key_name<typename ExecutionPolicy::kernelName>>
+void sort_by_key(ExecutionPolicy &sep, KeyIt keys_first, KeyIt keys_last,
+                 ValueIt values_first, ComparableOperator comp) {
+  typedef typename std::iterator_traits<KeyIt>::value_type key_type;
+  typedef typename std::iterator_traits<ValueIt>::value_type value_type;
+  typedef std::integral_constant<bool, Stable> stable_type;
+  using InitName = cl::sycl::helpers::NameGen<0, KernelName, key_type,
+                                              value_type, stable_type>;
+  using GatherName = cl::sycl::helpers::NameGen<1, KernelName, key_type,
+                                                value_type, stable_type>;
+  using SortName = cl::sycl::helpers::NameGen<2, KernelName, key_type,
+                                              value_type, stable_type>;
+
+  cl::sycl::queue q(sep.get_queue());
+  auto vectorSize = sycl::helpers::distance(keys_first, keys_last);
+  if (vectorSize < 2) {
+    return;
+  }
+  auto values_last = values_first;
+  std::advance(values_last, vectorSize);
+
+  auto keys = sycl::helpers::make_buffer(keys_first, keys_last);
+  auto values = sycl::helpers::make_buffer(values_first, values_last);
+  auto pairs = sycl::helpers::make_temp_buffer<key_index_pair<key_type>>(
+      vectorSize);
+  auto values_in = sycl::helpers::make_temp_buffer<value_type>(vectorSize);
+
+  q.submit([&](cl::sycl::handler &h) {
+    auto aK = keys.template get_access<cl::sycl::access::mode::read>(h);
+    auto aV = values.template get_access<cl::sycl::access::mode::read>(h);
+    auto aP = pairs.template get_access<cl::sycl::access::mode::write>(h);
+    auto aI = values_in.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<InitName>(
+        cl::sycl::range<1>{static_cast<size_t>(vectorSize)},
+        [aK, aV, aP, aI](cl::sycl::id<1> id) {
+          key_index_pair<key_type> p;
+          p.key = aK[id];
+          p.index = id[0];
+          aP[id] = p;
+          aI[id] = aV[id];
+        });
+  });
+
+  typedef key_index_comp<key_type, ComparableOperator, Stable> pair_comp;
+  bitonic_sort<key_index_pair<key_type>,
+               typename buffer_traits<decltype(pairs)>::allocator_type,
+               pair_comp, SortName>(q, pairs, vectorSize, pair_comp{comp});
+
+  q.submit([&](cl::sycl::handler &h) {
+    auto aP = pairs.template get_access<cl::sycl::access::mode::read>(h);
+    auto aI = values_in.template get_access<cl::sycl::access::mode::read>(h);
+    auto aK = keys.template get_access<cl::sycl::access::mode::write>(h);
+    auto aV = values.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<GatherName>(
+        cl::sycl::range<1>{static_cast<size_t>(vectorSize)},
+        [aK, aV, aP, aI](cl::sycl::id<1> id) {
+          key_index_pair<key_type> p = aP[id];
+          aK[id] = p.key;
+          aV[id] = aI[p.index];
+        });
+  });
+}
+
+/* sort_by_key.
+ * @brief Sorts the keys in increasing order and applies the same
+ * permutation to the values.
+ * The kernel names are distinct from the ones used with a user comparison.
+ */
+template <bool Stable, class ExecutionPolicy, class KeyIt, class ValueIt>
+void sort_by_key(ExecutionPolicy &sep, KeyIt keys_first, KeyIt keys_last,
+                 ValueIt values_first) {
+  typedef typename std::iterator_traits<KeyIt>::value_type key_type;
+  typedef typename ExecutionPolicy::kernelName kernelName;
+  sort_by_key<Stable, ExecutionPolicy, KeyIt, ValueIt, sort_greater<key_type>,
+              sort_by_key_name<sort_greater<kernelName>>>(
+      sep, keys_first, keys_last, values_first, sort_greater<key_type>());
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_SORT_BY_KEY__
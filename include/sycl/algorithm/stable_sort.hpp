@@ -0,0 +1,272 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_STABLE_SORT__
+#define __SYCL_IMPL_ALGORITHM_STABLE_SORT__
+
+#include <type_traits>
+#include <algorithm>
+#include <iterator>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_device_info.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/algorithm_composite_patterns.hpp>
+#include <sycl/algorithm/sort.hpp>
+#include <sycl/algorithm/sort_by_key.hpp>
+
+/** stable_sort_name.
+ * Class used to name the stable sort kernels per type.
+ */
+template <typename T>
+class stable_sort_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+namespace impl {
+
+/** stable_sort_after.
+ * Returns true when lhs must be placed strictly after rhs, i.e. when comp
+ * says so and does not say the opposite. This way equivalent elements are
+ * recognised whether comp is a strict comparison or not.
+ */
+template <typename T, class ComparableOperator>
+inline bool stable_sort_after(const T &lhs, const T &rhs,
+                              ComparableOperator comp) {
+  return comp(lhs, rhs) && !comp(rhs, lhs);
+}
+
+/** stable_sort_block_size.
+ * Size of the blocks sorted in local memory. The bitonic network sorts
+ * tiles of twice the work-group size, which is a power of two, and the tile
+ * of key_index_pair must fit in local memory.
+ */
+template <typename T>
+size_t stable_sort_block_size(cl::sycl::device device, size_t vectorSize) {
+  const auto info = sycl::helpers::get_device_info(device);
+  const size_t maxLocal =
+      std::min(info.max_work_group_size,
+               info.local_mem_size / (2 * sizeof(key_index_pair<T>)));
+  size_t local = 1;
+  while (2 * local <= maxLocal && 2 * local < vectorSize) {
+    local *= 2;
+  }
+  return 2 * local;
+}
+
+/* stable_sort_block.
+ * Sorts every block of blockSize elements of the buffer in local memory.
+ * The elements are paired with their position, which breaks the ties, and
+ * each block goes through the bitonic network of bitonic_sort_local, so
+ * every element costs O(log^2(blockSize)) comparisons.
+ */
+template <typename T, typename Alloc, class ComparableOperator, typename Name>
+void stable_sort_block(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                       size_t vectorSize, size_t blockSize,
+                       ComparableOperator comp) {
+  typedef key_index_pair<T> pair_type;
+  typedef key_index_comp<T, ComparableOperator, true> pair_comp;
+  using InitName = cl::sycl::helpers::NameGen<0, Name>;
+  using SortName = cl::sycl::helpers::NameGen<1, Name>;
+  using CopyName = cl::sycl::helpers::NameGen<2, Name>;
+
+  auto pairs = sycl::helpers::make_temp_buffer<pair_type>(vectorSize);
+  q.submit([&](cl::sycl::handler &h) {
+    auto a = buf.template get_access<cl::sycl::access::mode::read>(h);
+    auto aP = pairs.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<InitName>(cl::sycl::range<1>{vectorSize},
+                             [a, aP](cl::sycl::id<1> id) {
+                               pair_type p;
+                               p.key = a[id];
+                               p.index = id[0];
+                               aP[id] = p;
+                             });
+  });
+
+  // One work-group per block, each work-item handling a pair of the tile
+  const size_t local = blockSize / 2;
+  const cl::sycl::nd_range<1> ndRange{
+      cl::sycl::range<1>{up_rounded_division(vectorSize, blockSize) * local},
+      cl::sycl::range<1>{local}};
+  typedef typename buffer_traits<decltype(pairs)>::allocator_type alloc_;
+  bitonic_sort_local<pair_type, alloc_, pair_comp, SortName>(
+      q, pairs, 0, vectorSize, pair_comp{comp}, ndRange, 0, 0,
+      bitonic_sort_stages(blockSize) - 1);
+
+  q.submit([&](cl::sycl::handler &h) {
+    auto aP = pairs.template get_access<cl::sycl::access::mode::read>(h);
+    auto a = buf.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<CopyName>(
+        cl::sycl::range<1>{vectorSize},
+        [aP, a](cl::sycl::id<1> id) { a[id] = aP[id].key; });
+  });
+}
+
+/* stable_sort_merge.
+ * Merges every pair of consecutive sorted runs of the given width from src
+ * into dst. Each work-item finds the position of its element in the other
+ * run with a binary search (the merge path of the element); elements of the
+ * left run go before the equivalent elements of the right run.
+ */
+template <typename T, typename Alloc, class ComparableOperator, typename Name>
+void stable_sort_merge(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> src,
+                       cl::sycl::buffer<T, 1, Alloc> dst, size_t vectorSize,
+                       size_t width, ComparableOperator comp) {
+  q.submit([&](cl::sycl::handler &h) {
+    auto aS = src.template get_access<cl::sycl::access::mode::read>(h);
+    auto aD = dst.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<Name>(
+        cl::sycl::range<1>{vectorSize},
+        [aS, aD, vectorSize, width, comp](cl::sycl::id<1> id) {
+          const size_t p = id[0];
+          const size_t base = (p / (2 * width)) * 2 * width;
+          const size_t mid = std::min(base + width, vectorSize);
+          const size_t end = std::min(base + 2 * width, vectorSize);
+          const T x = aS[p];
+
+          if (p < mid) {
+            // Number of elements of the right run placed before x
+            size_t lo = mid, hi = end;
+            while (lo < hi) {
+              const size_t m = lo + (hi - lo) / 2;
+              if (stable_sort_after(x, aS[m], comp)) {
+                lo = m + 1;
+              } else {
+                hi = m;
+              }
+            }
+            aD[p + (lo - mid)] = x;
+          } else {
+            // Number of elements of the left run placed before x
+            size_t lo = base, hi = mid;
+            while (lo < hi) {
+              const size_t m = lo + (hi - lo) / 2;
+              if (!stable_sort_after(aS[m], x, comp)) {
+                lo = m + 1;
+              } else {
+                hi = m;
+              }
+            }
+            aD[(p - mid) + lo] = x;
+          }
+        });
+  });
+}
+
+/* stable_sort.
+ * Performs a stable sort on the given buffer: a block sort in local memory
+ * followed by merges of runs of increasing width, alternating between the
+ * buffer and a temporary one.
+ */
+template <typename T, typename Alloc, class ComparableOperator,
+          typename KernelName>
+void stable_sort(cl::sycl::queue q, cl::sycl::buffer<T, 1, Alloc> buf,
+                 size_t vectorSize, ComparableOperator comp) {
+  using BlockName = cl::sycl::helpers::NameGen<0, KernelName, T>;
+  using MergeName = cl::sycl::helpers::NameGen<1, KernelName, T>;
+  if (vectorSize < 2) {
+    return;
+  }
+
+  const size_t blockSize =
+      stable_sort_block_size<T>(q.get_device(), vectorSize);
+  stable_sort_block<T, Alloc, ComparableOperator, BlockName>(
+      q, buf, vectorSize, blockSize, comp);
+
+  cl::sycl::buffer<T, 1, Alloc> tmp{cl::sycl::range<1>{vectorSize}};
+#ifndef TRISYCL_CL_LANGUAGE_VERSION
+  tmp.set_final_data(nullptr);
+#endif
+  // The result must end in buf, hence an even number of merges is run: an
+  // extra merge with a width covering the whole range is a copy
+  size_t nbMerges = 0;
+  for (size_t width = blockSize; width < vectorSize; width *= 2) {
+    ++nbMerges;
+  }
+  nbMerges += nbMerges % 2;
+
+  size_t width = blockSize;
+  for (size_t merge = 0; merge < nbMerges; ++merge) {
+    if (merge % 2 == 0) {
+      stable_sort_merge<T, Alloc, ComparableOperator, MergeName>(
+          q, buf, tmp, vectorSize, width, comp);
+    } else {
+      stable_sort_merge<T, Alloc, ComparableOperator, MergeName>(
+          q, tmp, buf, vectorSize, width, comp);
+    }
+    if (width < vectorSize) {
+      width *= 2;
+    }
+  }
+}
+
+/** stable_sort
+ * @brief Function that sorts the given range with a Comp Operator, keeping
+ * the order of equivalent elements
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param last  : End of the range
+ * @param comp  : Comp Operator, returns true when the first element must be
+ *                placed after the second one
+ */
+template <class ExecutionPolicy, class RandomIt, class ComparableOperator,
+          typename KernelName =
+              stable_sort_name<typename ExecutionPolicy::kernelName>>
+void stable_sort(ExecutionPolicy &sep, RandomIt first, RandomIt last,
+                 ComparableOperator comp) {
+  cl::sycl::queue q(sep.get_queue());
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  auto buf = std::move(sycl::helpers::make_buffer(first, last));
+  auto vectorSize = buf.get_count();
+
+  stable_sort<type_, typename buffer_traits<decltype(buf)>::allocator_type,
+              ComparableOperator, KernelName>(q, buf, vectorSize, comp);
+}
+
+/** stable_sort
+ * @brief Function that sorts the given range in increasing order, keeping
+ * the order of equivalent elements
+ * @param sep   : Execution Policy
+ * @param first : Start of the range
+ * @param last  : End of the range
+ */
+template <class ExecutionPolicy, class RandomIt>
+void stable_sort(ExecutionPolicy &sep, RandomIt first, RandomIt last) {
+  typedef typename std::iterator_traits<RandomIt>::value_type type_;
+  typedef typename ExecutionPolicy::kernelName kernelName;
+  // The kernel names are distinct from the ones used with a user comparison
+  stable_sort<ExecutionPolicy, RandomIt, sort_greater<type_>,
+              stable_sort_name<sort_greater<kernelName>>>(
+      sep, first, last, sort_greater<type_>());
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_STABLE_SORT__
@@ -39,6 +39,36 @@
 namespace sycl {
 namespace impl {
 
+/** buffer_transform
+ * @brief Submits the kernel that applies an Unary Operator to bufI
+ * @param sep  : Execution Policy
+ * @param q    : Queue
+ * @param bufI : Input buffer
+ * @param bufO : Output buffer, of the same size
+ * @param op   : Unary Operator
+ * @return  The event of the kernel
+ */
+template <class ExecutionPolicy, class InBuffer, class OutBuffer,
+          class UnaryOperation>
+cl::sycl::event buffer_transform(ExecutionPolicy &sep, cl::sycl::queue &q,
+                                 InBuffer &bufI, OutBuffer &bufO,
+                                 UnaryOperation op) {
+  auto vectorSize = bufI.get_count();
+  const auto ndRange = sep.calculateNdRange(vectorSize);
+  auto f = [vectorSize, ndRange, &bufI, &bufO, op](
+      cl::sycl::handler &h) {
+    auto aI = bufI.template get_access<cl::sycl::access::mode::read>(h);
+    auto aO = bufO.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<typename ExecutionPolicy::kernelName>(
+        ndRange, [aI, aO, op, vectorSize](cl::sycl::nd_item<1> id) {
+          if ((id.get_global_id(0) < vectorSize)) {
+            aO[id.get_global_id(0)] = op(aI[id.get_global_id(0)]);
+          }
+        });
+  };
+  return q.submit(f);
+}
+
 /** transform sycl implementation
  * @brief Function that takes a Unary Operator and applies to the given range
  * @param sep : Execution Policy
@@ -54,23 +84,9 @@ OutputIterator transform(ExecutionPolicy &sep, Iterator b, Iterator e,
                          OutputIterator out, UnaryOperation op) {
   {
     cl::sycl::queue q(sep.get_queue());
-    auto device = q.get_device();
     auto bufI = sycl::helpers::make_const_buffer(b, e);
     auto bufO = sycl::helpers::make_buffer(out, out + bufI.get_count());
-    auto vectorSize = bufI.get_count();
-    const auto ndRange = sep.calculateNdRange(vectorSize);
-    auto f = [vectorSize, ndRange, &bufI, &bufO, op](
-        cl::sycl::handler &h) {
-      auto aI = bufI.template get_access<cl::sycl::access::mode::read>(h);
-      auto aO = bufO.template get_access<cl::sycl::access::mode::write>(h);
-      h.parallel_for<typename ExecutionPolicy::kernelName>(
-          ndRange, [aI, aO, op, vectorSize](cl::sycl::nd_item<1> id) {
-            if ((id.get_global_id(0) < vectorSize)) {
-              aO[id.get_global_id(0)] = op(aI[id.get_global_id(0)]);
-            }
-          });
-    };
-    q.submit(f);
+    buffer_transform(sep, q, bufI, bufO, op);
   }
   return out;
 }
@@ -0,0 +1,106 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_TRANSFORM_INCLUSIVE_SCAN__
+#define __SYCL_IMPL_ALGORITHM_TRANSFORM_INCLUSIVE_SCAN__
+
+#include <iterator>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+namespace sycl {
+namespace impl {
+
+/* transform_inclusive_scan.
+ * @brief Computes the inclusive scan of the range [b, e) transformed by uop,
+ * starting from init. uop is applied while the scan loads its tiles, so
+ * the transformed range is never stored.
+ */
+template <class ExecutionPolicy, class InputIterator, class OutputIterator,
+          class BinaryOperation, class UnaryOperation, class T>
+OutputIterator transform_inclusive_scan(ExecutionPolicy &snp,
+                                        InputIterator b, InputIterator e,
+                                        OutputIterator o,
+                                        BinaryOperation bop,
+                                        UnaryOperation uop, T init) {
+  typedef typename std::iterator_traits<OutputIterator>::value_type
+      output_type;
+  cl::sycl::queue q(snp.get_queue());
+  auto device = q.get_device();
+  size_t size = sycl::helpers::distance(b, e);
+  auto last = std::next(o, size);
+  if (size == 0) {
+    return o;
+  }
+  {
+    auto bufI = sycl::helpers::make_const_buffer(b, e);
+    auto bufO = sycl::helpers::make_buffer(o, last);
+    auto d = compute_mapscan_descriptor(device, size, sizeof(output_type));
+    buffer_mapscan_single_pass(snp, q, bufI, bufO,
+                               static_cast<output_type>(init), d, uop, bop,
+                               false);
+  }
+  return last;
+}
+
+/* transform_inclusive_scan.
+ * @brief Computes the inclusive scan of the range [b, e) transformed by uop.
+ * The scan starts from the transformed first element on the device.
+ */
+template <class ExecutionPolicy, class InputIterator, class OutputIterator,
+          class BinaryOperation, class UnaryOperation>
+OutputIterator transform_inclusive_scan(ExecutionPolicy &snp,
+                                        InputIterator b, InputIterator e,
+                                        OutputIterator o,
+                                        BinaryOperation bop,
+                                        UnaryOperation uop) {
+  typedef typename std::iterator_traits<OutputIterator>::value_type
+      output_type;
+  cl::sycl::queue q(snp.get_queue());
+  auto device = q.get_device();
+  size_t size = sycl::helpers::distance(b, e);
+  auto last = std::next(o, size);
+  if (size == 0) {
+    return o;
+  }
+  {
+    auto bufI = sycl::helpers::make_const_buffer(b, e);
+    auto bufO = sycl::helpers::make_buffer(o, last);
+    auto d = compute_mapscan_descriptor(device, size, sizeof(output_type));
+    buffer_mapscan_single_pass(snp, q, bufI, bufO, output_type(), d, uop,
+                               bop, false, false);
+  }
+  return last;
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_TRANSFORM_INCLUSIVE_SCAN__
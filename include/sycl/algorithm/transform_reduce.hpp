@@ -62,7 +62,7 @@ T transform_reduce(ExecutionPolicy& exec, InputIterator first,
     return init;
   }
 
-  cl::sycl::buffer<T, 1> bufR((cl::sycl::range<1>(vectorSize)));
+  auto bufR = sycl::helpers::make_temp_buffer<T>(vectorSize);
 
   auto device = q.get_device();
   auto bufI = sycl::helpers::make_const_buffer(first, last);
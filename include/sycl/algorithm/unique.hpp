@@ -0,0 +1,244 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+#ifndef __SYCL_IMPL_ALGORITHM_UNIQUE__
+#define __SYCL_IMPL_ALGORITHM_UNIQUE__
+
+#include <type_traits>
+#include <iterator>
+#include <utility>
+
+#include <sycl/helpers/sycl_buffers.hpp>
+#include <sycl/helpers/sycl_differences.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+#include <sycl/algorithm/copy_if.hpp>
+
+/** unique_name.
+ * Class used to name the unique kernels per type.
+ */
+template <typename T>
+class unique_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+
+template <class KernelName>
+class sycl_execution_policy;
+
+namespace impl {
+
+/* unique_heads.
+ * @brief Flags in positions the first element of every group of consecutive
+ * equivalent elements of input, scans the flags in place and returns the
+ * number of groups. The n-th group starts at the element that has n in
+ * positions and is the first one with that value.
+ */
+template <class FlagName, class ScanName, class T, class BinaryPredicate>
+size_t unique_heads(cl::sycl::queue q, cl::sycl::buffer<T, 1> input,
+                    cl::sycl::buffer<size_t, 1> positions, size_t size,
+                    BinaryPredicate pred) {
+  q.submit([&](cl::sycl::handler &h) {
+    auto aI = input.template get_access<cl::sycl::access::mode::read>(h);
+    auto aP = positions.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<FlagName>(
+        cl::sycl::range<1>{size}, [aI, aP, pred](cl::sycl::id<1> id) {
+          size_t pos = id[0];
+          aP[pos] = ((pos == 0) || !pred(aI[pos - 1], aI[pos])) ? 1 : 0;
+        });
+  });
+
+  auto d = compute_mapscan_descriptor(q.get_device(), size, sizeof(size_t));
+  sycl_execution_policy<ScanName> ssep(q);
+  impl::buffer_mapscan_single_pass(ssep, q, positions, positions, size_t(0),
+                                   d, scan_identity<size_t>(), compact_plus(),
+                                   false);
+  auto hP = positions.template get_access<cl::sycl::access::mode::read>();
+  return hP[size - 1];
+}
+
+/* unique_scatter.
+ * @brief Copies to output the first element of every group of input, at
+ * the position given by the scan of unique_heads.
+ */
+template <class KernelName, class T, class U>
+void unique_scatter(cl::sycl::queue q, cl::sycl::buffer<T, 1> input,
+                    cl::sycl::buffer<size_t, 1> positions,
+                    cl::sycl::buffer<U, 1> output, size_t size) {
+  q.submit([&](cl::sycl::handler &h) {
+    auto aI = input.template get_access<cl::sycl::access::mode::read>(h);
+    auto aP = positions.template get_access<cl::sycl::access::mode::read>(h);
+    auto aO = output.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<KernelName>(
+        cl::sycl::range<1>{size}, [aI, aP, aO](cl::sycl::id<1> id) {
+          size_t pos = id[0];
+          if ((pos == 0) || (aP[pos - 1] != aP[pos])) {
+            aO[aP[pos] - 1] = aI[pos];
+          }
+        });
+  });
+}
+
+/* unique_copy.
+ * @brief Copies the first element of every group of consecutive equivalent
+ * elements of [first, last) to the range beginning at result.
+ * The adjacent comparisons are flagged and scanned on the device, then the
+ * first elements are scattered. Only the number of groups is read back on
+ * the host, to size the output.
+ * @param sep    : Execution Policy
+ * @param first  : Start of the range
+ * @param last   : End of the range
+ * @param result : Start of the output range
+ * @param pred   : Binary predicate, returns true when two elements are
+ *                 equivalent
+ * When InPlace is true, result is first: if the input buffer is shared with
+ * the output one, the elements are scattered from a copy of the input.
+ * @return  The end of the output range
+ */
+template <bool InPlace = false, class ExecutionPolicy, class InputIt,
+          class OutputIt, class BinaryPredicate>
+OutputIt unique_copy(ExecutionPolicy &sep, InputIt first, InputIt last,
+                     OutputIt result, BinaryPredicate pred) {
+  typedef typename std::iterator_traits<InputIt>::value_type value_type;
+  typedef unique_name<typename ExecutionPolicy::kernelName> kernelName;
+  using FlagName = cl::sycl::helpers::NameGen<0, kernelName, value_type>;
+  using ScanName = cl::sycl::helpers::NameGen<1, kernelName, value_type>;
+  using ScatterName = cl::sycl::helpers::NameGen<2, kernelName, value_type>;
+  using CopyName = cl::sycl::helpers::NameGen<7, kernelName, value_type>;
+
+  cl::sycl::queue q(sep.get_queue());
+  size_t size = sycl::helpers::distance(first, last);
+  if (size < 1) {
+    return result;
+  }
+  auto input = sycl::helpers::make_const_buffer(first, last);
+  auto positions = sycl::helpers::make_temp_buffer<size_t>(size);
+  size_t count = unique_heads<FlagName, ScanName>(q, input, positions, size,
+                                                  pred);
+  auto result_last = std::next(result, count);
+  {
+    auto output = sycl::helpers::make_buffer(result, result_last);
+    if (InPlace && sycl::helpers::is_shared_range(first, last)) {
+      auto copy =
+          sycl::helpers::copy_to_temp_buffer<CopyName>(q, input, size);
+      unique_scatter<ScatterName>(q, copy, positions, output, size);
+    } else {
+      unique_scatter<ScatterName>(q, input, positions, output, size);
+    }
+  }
+  return result_last;
+}
+
+/* unique.
+ * @brief Removes all but the first element of every group of consecutive
+ * equivalent elements of [first, last). The input is read from its own
+ * buffer, or from a copy when its buffer is shared, so the result can be
+ * written over it.
+ */
+template <class ExecutionPolicy, class ForwardIt, class BinaryPredicate>
+ForwardIt unique(ExecutionPolicy &sep, ForwardIt first, ForwardIt last,
+                 BinaryPredicate pred) {
+  return impl::unique_copy<true>(sep, first, last, first, pred);
+}
+
+/* run_length_encode.
+ * @brief Writes the first element of every group of consecutive equivalent
+ * elements of [first, last) to the range beginning at values_out, and the
+ * length of the group to the range beginning at counts_out.
+ * The groups are found as in unique_copy; the scatter kernel also writes
+ * the end of every group, and a last kernel computes the lengths from the
+ * ends of consecutive groups.
+ * @return  The ends of both output ranges
+ */
+template <class ExecutionPolicy, class InputIt, class OutputIt1,
+          class OutputIt2, class BinaryPredicate>
+std::pair<OutputIt1, OutputIt2> run_length_encode(ExecutionPolicy &sep,
+                                                  InputIt first, InputIt last,
+                                                  OutputIt1 values_out,
+                                                  OutputIt2 counts_out,
+                                                  BinaryPredicate pred) {
+  typedef typename std::iterator_traits<InputIt>::value_type value_type;
+  typedef typename std::iterator_traits<OutputIt2>::value_type count_type;
+  typedef unique_name<typename ExecutionPolicy::kernelName> kernelName;
+  using FlagName = cl::sycl::helpers::NameGen<3, kernelName, value_type>;
+  using ScanName = cl::sycl::helpers::NameGen<4, kernelName, value_type>;
+  using ScatterName = cl::sycl::helpers::NameGen<5, kernelName, value_type>;
+  using CountName =
+      cl::sycl::helpers::NameGen<6, kernelName, value_type, count_type>;
+
+  cl::sycl::queue q(sep.get_queue());
+  size_t size = sycl::helpers::distance(first, last);
+  if (size < 1) {
+    return std::make_pair(values_out, counts_out);
+  }
+  auto input = sycl::helpers::make_const_buffer(first, last);
+  auto positions = sycl::helpers::make_temp_buffer<size_t>(size);
+  size_t count =
+      unique_heads<FlagName, ScanName>(q, input, positions, size, pred);
+  auto values_last = std::next(values_out, count);
+  auto counts_last = std::next(counts_out, count);
+  {
+    auto values = sycl::helpers::make_buffer(values_out, values_last);
+    auto counts = sycl::helpers::make_buffer(counts_out, counts_last);
+    auto ends = sycl::helpers::make_temp_buffer<size_t>(count);
+    q.submit([&](cl::sycl::handler &h) {
+      auto aI = input.template get_access<cl::sycl::access::mode::read>(h);
+      auto aP =
+          positions.template get_access<cl::sycl::access::mode::read>(h);
+      auto aV = values.template get_access<cl::sycl::access::mode::write>(h);
+      auto aE = ends.template get_access<cl::sycl::access::mode::write>(h);
+      h.parallel_for<ScatterName>(
+          cl::sycl::range<1>{size}, [aI, aP, aV, aE, size](cl::sycl::id<1> id) {
+            size_t pos = id[0];
+            if ((pos == 0) || (aP[pos - 1] != aP[pos])) {
+              aV[aP[pos] - 1] = aI[pos];
+            }
+            if ((pos == size - 1) || (aP[pos] != aP[pos + 1])) {
+              aE[aP[pos] - 1] = pos + 1;
+            }
+          });
+    });
+    q.submit([&](cl::sycl::handler &h) {
+      auto aE = ends.template get_access<cl::sycl::access::mode::read>(h);
+      auto aC = counts.template get_access<cl::sycl::access::mode::write>(h);
+      h.parallel_for<CountName>(
+          cl::sycl::range<1>{count}, [aE, aC](cl::sycl::id<1> id) {
+            size_t pos = id[0];
+            aC[pos] = static_cast<count_type>(
+                (pos == 0) ? aE[pos] : aE[pos] - aE[pos - 1]);
+          });
+    });
+  }
+  return std::make_pair(values_last, counts_last);
+}
+
+}  // namespace impl
+}  // namespace sycl
+
+#endif  // __SYCL_IMPL_ALGORITHM_UNIQUE__
@@ -0,0 +1,179 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+/**
+ * @file
+ * @brief Process-wide pool of the temporary buffers of the algorithms
+ * @detail The algorithms allocate scratch buffers on every call (partial
+ *    results of the reductions, tile status of the scans, ...). The blocks
+ *    of these buffers are kept in a pool per element type and size class
+ *    once the algorithm is done with them, so repeated calls on similar
+ *    sizes do not allocate.
+ */
+
+#ifndef __EXPERIMENTAL_DETAIL_SYCL_BUFFER_POOL__
+#define __EXPERIMENTAL_DETAIL_SYCL_BUFFER_POOL__
+
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace sycl {
+namespace helpers {
+
+/* Free blocks kept per size class, and size in bytes of the largest block
+ * kept in the pool: larger blocks are released when they are done with.
+ */
+constexpr size_t temp_buffer_pool_depth = 4;
+constexpr size_t temp_buffer_pool_max_bytes = size_t(1) << 24;
+
+namespace detail {
+
+/* temp_buffer_size_class.
+ * @brief Size classes are the powers of two, so a block serves every size
+ * between half its size and its size.
+ */
+inline size_t temp_buffer_size_class(size_t size) {
+  size_t size_class = 1;
+  while (size_class < size) {
+    size_class <<= 1;
+  }
+  return size_class;
+}
+
+/** temp_buffer_pool.
+ * Free blocks of one element type, by size class.
+ */
+template <typename T>
+class temp_buffer_pool {
+  std::mutex mutex_;
+  std::map<size_t, std::vector<cl::sycl::buffer<T, 1>>> free_blocks_;
+
+ public:
+  static temp_buffer_pool &get() {
+    static temp_buffer_pool pool;
+    return pool;
+  }
+
+  cl::sycl::buffer<T, 1> acquire(size_t size_class) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = free_blocks_.find(size_class);
+      if (it != free_blocks_.end() && !it->second.empty()) {
+        cl::sycl::buffer<T, 1> block = it->second.back();
+        it->second.pop_back();
+        return block;
+      }
+    }
+    cl::sycl::buffer<T, 1> block((cl::sycl::range<1>(size_class)));
+#ifndef TRISYCL_CL_LANGUAGE_VERSION
+    block.set_final_data(nullptr);
+#endif
+    return block;
+  }
+
+  void release(size_t size_class, const cl::sycl::buffer<T, 1> &block) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &blocks = free_blocks_[size_class];
+    if (blocks.size() < temp_buffer_pool_depth) {
+      blocks.push_back(block);
+    }
+  }
+};
+
+}  // namespace detail
+
+/** temp_buffer.
+ * Buffer of size elements drawn from the pool: it is the block itself, or
+ * a sub-buffer at the start of the block when the size is not a size
+ * class. The block goes back to the pool when the temp_buffer is
+ * destroyed, so the temp_buffer can be moved but not copied, and copies of
+ * it as a cl::sycl::buffer must not outlive it.
+ * The content of the buffer is undefined, as for a new buffer.
+ */
+template <typename T>
+class temp_buffer : public cl::sycl::buffer<T, 1> {
+  cl::sycl::buffer<T, 1> block_;
+  // 0 when the block is not returned to the pool
+  size_t size_class_;
+
+  temp_buffer(cl::sycl::buffer<T, 1> view, cl::sycl::buffer<T, 1> block,
+              size_t size_class)
+      : cl::sycl::buffer<T, 1>(std::move(view)),
+        block_(std::move(block)),
+        size_class_(size_class) {}
+
+ public:
+  /* make.
+   * @brief Draws a buffer of size elements from the pool.
+   */
+  static temp_buffer make(size_t size) {
+    size_t size_class = detail::temp_buffer_size_class(size);
+    if (size == 0 || size_class * sizeof(T) > temp_buffer_pool_max_bytes) {
+      cl::sycl::buffer<T, 1> buf((cl::sycl::range<1>(size)));
+#ifndef TRISYCL_CL_LANGUAGE_VERSION
+      buf.set_final_data(nullptr);
+#endif
+      return temp_buffer(buf, buf, 0);
+    }
+    cl::sycl::buffer<T, 1> block =
+        detail::temp_buffer_pool<T>::get().acquire(size_class);
+    if (size == size_class) {
+      return temp_buffer(block, block, size_class);
+    }
+    cl::sycl::buffer<T, 1> view(block, cl::sycl::id<1>(0),
+                                cl::sycl::range<1>(size));
+    return temp_buffer(view, block, size_class);
+  }
+
+  temp_buffer(temp_buffer &&other)
+      : cl::sycl::buffer<T, 1>(
+            static_cast<cl::sycl::buffer<T, 1> &&>(other)),
+        block_(std::move(other.block_)),
+        size_class_(other.size_class_) {
+    other.size_class_ = 0;
+  }
+
+  temp_buffer(const temp_buffer &) = delete;
+  temp_buffer &operator=(const temp_buffer &) = delete;
+  temp_buffer &operator=(temp_buffer &&) = delete;
+
+  ~temp_buffer() {
+    if (size_class_ != 0) {
+      detail::temp_buffer_pool<T>::get().release(size_class_, block_);
+    }
+  }
+};
+
+}  // namespace helpers
+}  // namespace sycl
+
+#endif  // __EXPERIMENTAL_DETAIL_SYCL_BUFFER_POOL__
@@ -44,6 +44,7 @@
 #include <type_traits>
 #include <typeinfo>
 #include <memory>
+#include <vector>
 
 /** @defgroup sycl_helpers
  *
@@ -53,6 +54,9 @@
  */
 
 #include <sycl/helpers/sycl_iterator.hpp>
+#include <sycl/helpers/sycl_buffer_pool.hpp>
+#include <sycl/helpers/sycl_device_cache.hpp>
+#include <sycl/helpers/sycl_device_info.hpp>
 
 /** \addtogroup sycl
  * @{
@@ -60,6 +64,40 @@
 namespace sycl {
 namespace helpers {
 
+/**
+ * @brief True when the range [b, e) of the iterator is a block of
+ *   contiguous host memory, i.e. a pointer or a std::vector iterator.
+ *   std::vector<bool> is excluded since its elements are packed.
+ *   triSYCL already builds its buffers directly from the iterators.
+ */
+template <typename Iterator>
+struct is_contiguous_input_iterator {
+#ifdef TRISYCL_CL_LANGUAGE_VERSION
+  static constexpr bool value = false;
+#else
+  typedef typename std::iterator_traits<Iterator>::value_type type_;
+  static constexpr bool value =
+      !std::is_same<type_, bool>::value &&
+      (std::is_pointer<Iterator>::value ||
+       std::is_same<Iterator, typename std::vector<type_>::iterator>::value ||
+       std::is_same<Iterator,
+                    typename std::vector<type_>::const_iterator>::value);
+#endif
+};
+
+/**
+ * @brief True when the range [b, e) of the iterator is a writable block of
+ *   contiguous host memory.
+ */
+template <typename Iterator>
+struct is_contiguous_iterator {
+  typedef typename std::iterator_traits<Iterator>::value_type type_;
+  static constexpr bool value =
+      is_contiguous_input_iterator<Iterator>::value &&
+      std::is_same<typename std::iterator_traits<Iterator>::reference,
+                   type_&>::value;
+};
+
 /**
  *
  * @brief Creates a buffer from a random access iterator that triggers
@@ -70,7 +108,8 @@ namespace helpers {
  */
 template <typename Iterator,
           typename std::enable_if<
-              !std::is_base_of<SyclIterator, Iterator>::value>::type* = nullptr>
+              !std::is_base_of<SyclIterator, Iterator>::value &&
+              !is_contiguous_iterator<Iterator>::value>::type* = nullptr>
 cl::sycl::buffer<typename std::iterator_traits<Iterator>::value_type, 1>
 make_buffer_impl(Iterator b, Iterator e, std::random_access_iterator_tag) {
   typedef typename std::iterator_traits<Iterator>::value_type type_;
@@ -94,6 +133,34 @@ make_buffer_impl(Iterator b, Iterator e, std::random_access_iterator_tag) {
   return buf;
 }
 
+/**
+ *
+ * @brief Creates a buffer that uses the contiguous host memory of the range
+ *  directly, so there is no staging copy: the data is written back to the
+ *  range when the buffer is destroyed. Inside a device_cache region, the
+ *  buffer is the one of the cache.
+ * @param Iterator b  Start of the range
+ * @param Iterator e  End of the range
+ * @param std::random_access_iterator_tag Used for iterator dispatch only
+ */
+template <typename Iterator,
+          typename std::enable_if<
+              !std::is_base_of<SyclIterator, Iterator>::value &&
+              is_contiguous_iterator<Iterator>::value>::type* = nullptr>
+cl::sycl::buffer<typename std::iterator_traits<Iterator>::value_type, 1>
+make_buffer_impl(Iterator b, Iterator e, std::random_access_iterator_tag) {
+  typedef typename std::iterator_traits<Iterator>::value_type type_;
+  size_t bufferSize = std::distance(b, e);
+  type_* ptr = bufferSize ? std::addressof(*b) : nullptr;
+  device_cache* cache = device_cache::active();
+  if (cache != nullptr && bufferSize > 0) {
+    return cache->get(ptr, bufferSize);
+  }
+  cl::sycl::buffer<type_, 1> buf(ptr, cl::sycl::range<1>(bufferSize));
+  buf.set_final_data(ptr);
+  return buf;
+}
+
 /**
  *
  * @brief Creates a buffer from the given input-only iterator.
@@ -105,16 +172,135 @@ make_buffer_impl(Iterator b, Iterator e, std::random_access_iterator_tag) {
  */
 template <typename Iterator,
           typename std::enable_if<
-              !std::is_base_of<SyclIterator, Iterator>::value>::type* =
+              !std::is_base_of<SyclIterator, Iterator>::value &&
+              !is_contiguous_input_iterator<Iterator>::value>::type* =
+                                             nullptr>
+cl::sycl::buffer<typename std::iterator_traits<Iterator>::value_type, 1>
+make_buffer_impl(Iterator b, Iterator e, std::input_iterator_tag) {
+  using type_= typename std::iterator_traits<Iterator>::value_type;
+  cl::sycl::buffer<type_, 1> buf { b ,e };
+  buf.set_final_data(nullptr);
+  return buf;
+}
+
+/**
+ *
+ * @brief Creates a buffer from the given contiguous input-only iterator.
+ * Inside a device_cache region, the buffer is the one of the cache, so it
+ * holds the data written by the previous calls.
+ * @param Iterator b  Start of the range
+ * @param Iterator e  End of the range
+ * @param std::input_access_iterator_tag Used for iterator dispatch only
+ */
+template <typename Iterator,
+          typename std::enable_if<
+              !std::is_base_of<SyclIterator, Iterator>::value &&
+              is_contiguous_input_iterator<Iterator>::value>::type* =
                                              nullptr>
 cl::sycl::buffer<typename std::iterator_traits<Iterator>::value_type, 1>
 make_buffer_impl(Iterator b, Iterator e, std::input_iterator_tag) {
   using type_= typename std::iterator_traits<Iterator>::value_type;
+  size_t bufferSize = std::distance(b, e);
+  device_cache* cache = device_cache::active();
+  if (cache != nullptr && bufferSize > 0) {
+    return cache->get_const(std::addressof(*b), bufferSize);
+  }
   cl::sycl::buffer<type_, 1> buf { b ,e };
   buf.set_final_data(nullptr);
   return buf;
 }
 
+namespace detail {
+
+/* range_copy.
+ * Copy of the range [first, first + count) of a buffer, made when the range
+ * cannot be a sub-buffer. When write_back is set, the copy is written back
+ * to the range once the last range_buffer holding it is destroyed.
+ */
+template <typename T, typename Alloc>
+struct range_copy {
+  cl::sycl::buffer<T, 1, Alloc> parent;
+  cl::sycl::buffer<T, 1, Alloc> copy;
+  size_t first;
+  bool write_back;
+
+  range_copy(cl::sycl::buffer<T, 1, Alloc> parent_, size_t first_,
+             size_t count, bool write_back_)
+      : parent(parent_), copy(cl::sycl::range<1>(count)), first(first_),
+        write_back(write_back_) {
+    auto aP = parent.template get_access<cl::sycl::access::mode::read>(
+        cl::sycl::range<1>(count), cl::sycl::id<1>(first));
+    auto aC = copy.template get_access<cl::sycl::access::mode::write>();
+    for (size_t i = 0; i < count; ++i) {
+      aC[i] = aP[i];
+    }
+  }
+
+  ~range_copy() {
+    if (!write_back) {
+      return;
+    }
+    size_t count = copy.get_count();
+    auto aC = copy.template get_access<cl::sycl::access::mode::read>();
+    auto aP = parent.template get_access<cl::sycl::access::mode::write>(
+        cl::sycl::range<1>(count), cl::sycl::id<1>(first));
+    for (size_t i = 0; i < count; ++i) {
+      aP[i] = aC[i];
+    }
+  }
+};
+
+}  // namespace detail
+
+/* range_buffer.
+ * Buffer of the range of a SYCL-enabled iterator: the buffer of the
+ * iterator, one of its sub-buffers, or a copy of the range that is written
+ * back when the last range_buffer holding it goes out of scope.
+ */
+template <typename T, typename Alloc>
+class range_buffer : public cl::sycl::buffer<T, 1, Alloc> {
+  std::shared_ptr<detail::range_copy<T, Alloc>> copy_;
+
+ public:
+  range_buffer(cl::sycl::buffer<T, 1, Alloc> buf)
+      : cl::sycl::buffer<T, 1, Alloc>(buf) {}
+
+  range_buffer(std::shared_ptr<detail::range_copy<T, Alloc>> copy)
+      : cl::sycl::buffer<T, 1, Alloc>(copy->copy), copy_(copy) {}
+};
+
+/**
+ *
+ * @brief Extracts the buffer of a SYCL-enabled iterator restricted to the
+ *  range [b, e): the buffer itself when the range covers it, a sub-buffer
+ *  of the range when its start meets the sub-buffer alignment of the
+ *  devices, a copy of the range otherwise. The copy goes through the host,
+ *  and is written back when write_back is set: algorithms able to work at
+ *  an offset of the buffer use make_inplace_buffer instead.
+ * @param Iterator b  Start of the range
+ * @param Iterator e  End of the range
+ * @param bool write_back  Whether the range may be written to
+ */
+template <typename Iterator>
+range_buffer<typename std::iterator_traits<Iterator>::value_type,
+             typename Iterator::allocator_type>
+reuse_buffer_range(Iterator b, Iterator e, bool write_back) {
+  typedef typename std::iterator_traits<Iterator>::value_type type_;
+  typedef typename Iterator::allocator_type alloc_;
+  auto buf = b.get_buffer();
+  size_t first = b.get_pos();
+  size_t last = e.get_pos();
+  if (first >= last || (first == 0 && last == buf.get_count())) {
+    return buf;
+  }
+  if ((first * sizeof(type_)) % get_sub_buffer_alignment() == 0) {
+    return cl::sycl::buffer<type_, 1, alloc_>(
+        buf, cl::sycl::id<1>(first), cl::sycl::range<1>(last - first));
+  }
+  return std::make_shared<detail::range_copy<type_, alloc_>>(
+      buf, first, last - first, write_back);
+}
+
 /**
  *
  * @brief Extracts an existing buffer from a SYCL-enabled iterator,
@@ -124,13 +310,11 @@ make_buffer_impl(Iterator b, Iterator e, std::input_iterator_tag) {
  * @param std::input_iterator_tag Used for iterator dispatch only
  */
 template <typename Iterator>
-cl::sycl::buffer<typename std::iterator_traits<Iterator>::value_type, 1,
-                 typename Iterator::allocator_type>
+range_buffer<typename std::iterator_traits<Iterator>::value_type,
+             typename Iterator::allocator_type>
 reuse_buffer_impl(Iterator b, Iterator e, std::input_iterator_tag) {
-  // TODO: This may need to create a sub-buffer if the range does not match
-  //  the whole buffer.
   //  TODO: Technically this can be a const buffer since it is input-only
-  return b.get_buffer();
+  return reuse_buffer_range(b, e, false);
 }
 
 /**
@@ -142,12 +326,10 @@ reuse_buffer_impl(Iterator b, Iterator e, std::input_iterator_tag) {
  * @param std::input_iterator_tag Used for iterator dispatch only
  */
 template <typename Iterator>
-cl::sycl::buffer<typename std::iterator_traits<Iterator>::value_type, 1,
-                 typename Iterator::allocator_type>
+range_buffer<typename std::iterator_traits<Iterator>::value_type,
+             typename Iterator::allocator_type>
 reuse_buffer_impl(Iterator b, Iterator e, std::random_access_iterator_tag) {
-  // TODO: This may need to create a sub-buffer if the range does not match
-  //  the whole buffer.
-  return b.get_buffer();
+  return reuse_buffer_range(b, e, true);
 }
 
 /**
@@ -159,8 +341,8 @@ reuse_buffer_impl(Iterator b, Iterator e, std::random_access_iterator_tag) {
  */
 template <class Iterator, typename std::enable_if<std::is_base_of<
                               SyclIterator, Iterator>::value>::type* = nullptr>
-cl::sycl::buffer<typename std::iterator_traits<Iterator>::value_type, 1,
-                 typename Iterator::allocator_type>
+range_buffer<typename std::iterator_traits<Iterator>::value_type,
+             typename Iterator::allocator_type>
 make_buffer(Iterator b, Iterator e) {
   return reuse_buffer_impl(
       b, e, typename std::iterator_traits<Iterator>::iterator_category());
@@ -188,8 +370,8 @@ make_buffer(Iterator b, Iterator e) {
  */
 template <class Iterator, typename std::enable_if<std::is_base_of<
                               SyclIterator, Iterator>::value>::type* = nullptr>
-cl::sycl::buffer<typename std::iterator_traits<Iterator>::value_type, 1,
-                 typename Iterator::allocator_type>
+range_buffer<typename std::iterator_traits<Iterator>::value_type,
+             typename Iterator::allocator_type>
 make_const_buffer(Iterator b, Iterator e) {
   return reuse_buffer_impl(b, e, std::input_iterator_tag());
 }
@@ -208,16 +390,99 @@ make_const_buffer(Iterator b, Iterator e) {
 }
 
 /**
- * @brief Constructs a read/write sycl buffer given a type and size
+ * @brief Buffer of the range [b, e) for the algorithms that work in place on
+ *   a range at an offset of a buffer, such as sort. For a SYCL-enabled
+ *   iterator range that cannot be a sub-buffer, this is the buffer of the
+ *   iterators, so the range is neither copied nor written back through the
+ *   host. Otherwise this is the buffer returned by make_buffer.
+ * @param Iterator b  Start of the range
+ * @param Iterator e  End of the range
+ * @param size_t offset  Set to the position of the range in the buffer
+ */
+template <class Iterator, typename std::enable_if<std::is_base_of<
+                              SyclIterator, Iterator>::value>::type* = nullptr>
+range_buffer<typename std::iterator_traits<Iterator>::value_type,
+             typename Iterator::allocator_type>
+make_inplace_buffer(Iterator b, Iterator e, size_t &offset) {
+  typedef typename std::iterator_traits<Iterator>::value_type type_;
+  size_t first = b.get_pos();
+  offset = 0;
+  if (first < e.get_pos() &&
+      (first * sizeof(type_)) % get_sub_buffer_alignment() != 0) {
+    offset = first;
+    return b.get_buffer();
+  }
+  return make_buffer(b, e);
+}
+
+/**
+ * @brief Buffer of the range [b, e) for the algorithms that work in place,
+ *   when using normal iterators: the buffer returned by make_buffer.
+ * @param Iterator b  Start of the range
+ * @param Iterator e  End of the range
+ * @param size_t offset  Set to 0
+ */
+template <class Iterator,
+          typename std::enable_if<
+              !std::is_base_of<SyclIterator, Iterator>::value>::type* = nullptr>
+cl::sycl::buffer<typename std::iterator_traits<Iterator>::value_type, 1>
+make_inplace_buffer(Iterator b, Iterator e, size_t &offset) {
+  offset = 0;
+  return make_buffer(b, e);
+}
+
+/**
+ * @brief True when the buffers made for [b, e) may be shared with other
+ *   buffers of the same range, i.e. for SYCL iterators and for contiguous
+ *   ranges inside a device_cache region. An algorithm writing over its
+ *   input must then read the input from a copy.
+ * @param Iterator b  Start of the range
+ * @param Iterator e  End of the range
+ */
+template <class Iterator, typename std::enable_if<std::is_base_of<
+                              SyclIterator, Iterator>::value>::type* = nullptr>
+bool is_shared_range(Iterator b, Iterator e) {
+  return true;
+}
+
+template <class Iterator,
+          typename std::enable_if<
+              !std::is_base_of<SyclIterator, Iterator>::value>::type* = nullptr>
+bool is_shared_range(Iterator b, Iterator e) {
+  return is_contiguous_input_iterator<Iterator>::value &&
+         device_cache::active() != nullptr;
+}
+
+/**
+ * @brief Constructs a read/write sycl buffer given a type and size, drawn
+ *   from the pool of temporary buffers
  * @param size_t size
  */
 template <class ElemT>
-cl::sycl::buffer<ElemT, 1> make_temp_buffer(size_t size) {
-  cl::sycl::buffer<ElemT, 1> buf((cl::sycl::range<1>(size)));
-#ifndef TRISYCL_CL_LANGUAGE_VERSION
-  buf.set_final_data(nullptr);
-#endif
-  return buf;
+temp_buffer<ElemT> make_temp_buffer(size_t size) {
+  return temp_buffer<ElemT>::make(size);
+}
+
+/**
+ * @brief Copies the first size elements of buf to a temporary buffer on
+ *   the device
+ * @param cl::sycl::queue q
+ * @param cl::sycl::buffer buf
+ * @param size_t size
+ */
+template <class KernelName, class ElemT, class Alloc>
+temp_buffer<ElemT> copy_to_temp_buffer(cl::sycl::queue q,
+                                       cl::sycl::buffer<ElemT, 1, Alloc> buf,
+                                       size_t size) {
+  auto copy = make_temp_buffer<ElemT>(size);
+  q.submit([&](cl::sycl::handler& h) {
+    auto aI = buf.template get_access<cl::sycl::access::mode::read>(h);
+    auto aO = copy.template get_access<cl::sycl::access::mode::write>(h);
+    h.parallel_for<KernelName>(
+        cl::sycl::range<1>{size},
+        [aI, aO](cl::sycl::id<1> id) { aO[id] = aI[id]; });
+  });
+  return copy;
 }
 
 } /** @} namespace helpers */
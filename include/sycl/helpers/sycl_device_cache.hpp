@@ -0,0 +1,211 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+/**
+ * @file
+ * @brief Residency region for host ranges
+ * @detail Every algorithm call on host iterators creates buffers over the
+ *    ranges, which copy the data to the device and back to the host. While
+ *    a device_cache is alive, the buffers of contiguous host ranges are kept
+ *    in the cache instead: the next algorithm calls on the same range reuse
+ *    the buffer, and the data is copied back once, when the cache is
+ *    destroyed or flushed.
+ */
+
+#ifndef __EXPERIMENTAL_DETAIL_SYCL_DEVICE_CACHE__
+#define __EXPERIMENTAL_DETAIL_SYCL_DEVICE_CACHE__
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+#include <sycl/helpers/sycl_device_info.hpp>
+
+namespace sycl {
+namespace helpers {
+
+/** device_cache.
+ * Scoped residency region: the algorithms called on the thread while the
+ * cache is alive keep the buffers of pointers and std::vector ranges in
+ * the cache, keyed by the host address and size of the range. A range
+ * inside a cached range uses a sub-buffer of it when its start meets the
+ * sub-buffer alignment of the devices; any other range that overlaps
+ * cached ranges flushes them first.
+ * The host must not read or write the ranges until the cache is flushed or
+ * destroyed. A region opened inside another one uses the cache of the
+ * outermost region, so the data is copied back when the outermost region
+ * ends.
+ */
+class device_cache {
+  struct entry {
+    const char *begin;
+    const char *end;
+    std::type_index type;
+    // cl::sycl::buffer<T, 1> holding the range
+    std::shared_ptr<void> buffer;
+    // whether the buffer copies back to the host
+    bool writable;
+  };
+
+  std::vector<entry> entries_;
+  // outermost region, this one if there is no other region alive
+  device_cache *owner_;
+
+  static device_cache *&current() {
+    static thread_local device_cache *cache = nullptr;
+    return cache;
+  }
+
+  /* Returns the entry containing [begin, end) if a sub-buffer of it can
+   * start at begin. Otherwise flushes the entries overlapping it, so the
+   * cached ranges never overlap.
+   */
+  template <typename T>
+  entry *lookup(const char *begin, const char *end) {
+    std::less<const char *> less;
+    for (auto &e : entries_) {
+      if (e.type == std::type_index(typeid(T)) && !less(begin, e.begin) &&
+          !less(e.end, end) &&
+          size_t(begin - e.begin) % get_sub_buffer_alignment() == 0) {
+        return &e;
+      }
+    }
+    entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                                  [&](const entry &e) {
+                                    return less(begin, e.end) &&
+                                           less(e.begin, end);
+                                  }),
+                   entries_.end());
+    return nullptr;
+  }
+
+  template <typename T>
+  static cl::sycl::buffer<T, 1> view(const entry &e, const T *ptr,
+                                     size_t count) {
+    cl::sycl::buffer<T, 1> buf =
+        *static_cast<cl::sycl::buffer<T, 1> *>(e.buffer.get());
+    size_t offset = ptr - reinterpret_cast<const T *>(e.begin);
+    if (offset == 0 && count == buf.get_count()) {
+      return buf;
+    }
+    return cl::sycl::buffer<T, 1>(buf, cl::sycl::id<1>(offset),
+                                  cl::sycl::range<1>(count));
+  }
+
+ public:
+  device_cache() : owner_(current() ? current() : this) {
+    current() = owner_;
+  }
+
+  device_cache(const device_cache &) = delete;
+  device_cache &operator=(const device_cache &) = delete;
+
+  ~device_cache() {
+    if (owner_ == this) {
+      flush();
+      current() = nullptr;
+    }
+  }
+
+  /* active.
+   * @brief The cache of the outermost region alive on the thread, nullptr
+   * if none.
+   */
+  static device_cache *active() { return current(); }
+
+  /* flush.
+   * @brief Releases the buffers, copying the ranges written on the device
+   * back to the host.
+   */
+  void flush() { owner_->entries_.clear(); }
+
+  /* get.
+   * @brief Buffer of the count elements at ptr, copied back to the host
+   * when the cache is flushed.
+   */
+  template <typename T>
+  cl::sycl::buffer<T, 1> get(T *ptr, size_t count) {
+    if (owner_ != this) {
+      return owner_->get(ptr, count);
+    }
+    const char *begin = reinterpret_cast<const char *>(ptr);
+    const char *end = reinterpret_cast<const char *>(ptr + count);
+    entry *e = lookup<T>(begin, end);
+    if (e == nullptr) {
+      std::shared_ptr<cl::sycl::buffer<T, 1>> buf =
+          std::make_shared<cl::sycl::buffer<T, 1>>(ptr,
+                                                   cl::sycl::range<1>(count));
+      buf->set_final_data(ptr);
+      entries_.push_back(
+          entry{begin, end, std::type_index(typeid(T)), buf, true});
+      return *buf;
+    }
+    if (!e->writable) {
+      T *first = const_cast<T *>(reinterpret_cast<const T *>(e->begin));
+      static_cast<cl::sycl::buffer<T, 1> *>(e->buffer.get())
+          ->set_final_data(first);
+      e->writable = true;
+    }
+    return view(*e, ptr, count);
+  }
+
+  /* get_const.
+   * @brief Buffer of the count elements at ptr, only read on the device.
+   */
+  template <typename T>
+  cl::sycl::buffer<T, 1> get_const(const T *ptr, size_t count) {
+    if (owner_ != this) {
+      return owner_->get_const(ptr, count);
+    }
+    const char *begin = reinterpret_cast<const char *>(ptr);
+    const char *end = reinterpret_cast<const char *>(ptr + count);
+    entry *e = lookup<T>(begin, end);
+    if (e == nullptr) {
+      std::shared_ptr<cl::sycl::buffer<T, 1>> buf =
+          std::make_shared<cl::sycl::buffer<T, 1>>(ptr,
+                                                   cl::sycl::range<1>(count));
+#ifndef TRISYCL_CL_LANGUAGE_VERSION
+      buf->set_final_data(nullptr);
+#endif
+      entries_.push_back(
+          entry{begin, end, std::type_index(typeid(T)), buf, false});
+      return *buf;
+    }
+    return view(*e, ptr, count);
+  }
+};
+
+}  // namespace helpers
+}  // namespace sycl
+
+#endif  // __EXPERIMENTAL_DETAIL_SYCL_DEVICE_CACHE__
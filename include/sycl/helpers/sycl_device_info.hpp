@@ -0,0 +1,130 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+/**
+ * @file
+ * @brief Process-wide cache of the device capabilities
+ * @detail The algorithms size their kernels from a few device queries. Each
+ *    query can be a round trip to the driver, so the capabilities are read
+ *    once per device and kept for the lifetime of the process.
+ */
+
+#ifndef __EXPERIMENTAL_DETAIL_SYCL_DEVICE_INFO__
+#define __EXPERIMENTAL_DETAIL_SYCL_DEVICE_INFO__
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace sycl {
+namespace helpers {
+
+/** device_info.
+ * Capabilities of a device used to size the kernels of the algorithms.
+ * key is unique per device in the process, so it can be used to index
+ * other caches.
+ */
+struct device_info {
+  size_t key;
+  size_t max_compute_units;
+  // maximum number of work-items of a one-dimensional work-group
+  size_t max_work_group_size;
+  size_t local_mem_size;
+};
+
+namespace detail {
+
+struct device_info_entry {
+  cl::sycl::device device;
+  device_info info;
+};
+
+inline std::mutex &device_info_mutex() {
+  static std::mutex m;
+  return m;
+}
+
+inline std::vector<device_info_entry> &device_info_registry() {
+  static std::vector<device_info_entry> registry;
+  return registry;
+}
+
+}  // namespace detail
+
+/* get_device_info.
+ * @brief Returns the capabilities of the device, querying the device the
+ * first time only. There are few devices, so they are looked up linearly.
+ */
+inline device_info get_device_info(const cl::sycl::device &device) {
+  std::lock_guard<std::mutex> lock(detail::device_info_mutex());
+  auto &registry = detail::device_info_registry();
+  for (const auto &entry : registry) {
+    if (entry.device == device) {
+      return entry.info;
+    }
+  }
+  const cl::sycl::id<3> max_work_item_sizes =
+      device.get_info<cl::sycl::info::device::max_work_item_sizes>();
+  device_info info;
+  info.key = registry.size();
+  info.max_compute_units =
+      device.get_info<cl::sycl::info::device::max_compute_units>();
+  info.max_work_group_size = std::min(
+      static_cast<size_t>(
+          device.get_info<cl::sycl::info::device::max_work_group_size>()),
+      static_cast<size_t>(max_work_item_sizes[0]));
+  info.local_mem_size = static_cast<size_t>(
+      device.get_info<cl::sycl::info::device::local_mem_size>());
+  registry.push_back(detail::device_info_entry{device, info});
+  return info;
+}
+
+/* get_sub_buffer_alignment.
+ * @brief Returns the alignment in bytes that the start of a sub-buffer must
+ * meet on every device of the system, i.e. the largest base address
+ * alignment among them. The devices are queried the first time only.
+ */
+inline size_t get_sub_buffer_alignment() {
+  static const size_t alignment = []() {
+    size_t bits = 8;
+    for (const auto &device : cl::sycl::device::get_devices()) {
+      bits = std::max(
+          bits, static_cast<size_t>(device.get_info<
+                    cl::sycl::info::device::mem_base_addr_align>()));
+    }
+    return bits / 8;
+  }();
+  return alignment;
+}
+
+}  // namespace helpers
+}  // namespace sycl
+
+#endif  // __EXPERIMENTAL_DETAIL_SYCL_DEVICE_INFO__
@@ -0,0 +1,129 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+/**
+ * @file
+ * @brief Handle on an algorithm that runs asynchronously
+ * @detail The asynchronous algorithms submit their kernels and return
+ *    straight away. The handle keeps the buffers of the algorithm alive, so
+ *    the copy back to the host is only done when the handle is waited for.
+ */
+
+#ifndef __EXPERIMENTAL_DETAIL_SYCL_FUTURE__
+#define __EXPERIMENTAL_DETAIL_SYCL_FUTURE__
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace sycl {
+namespace helpers {
+
+/** sycl_future.
+ * Holds the event of the last command group of an algorithm, the buffers
+ * it works on and the function that computes its result once it is done.
+ * Destroying the handle without waiting for it blocks as the destruction of
+ * the buffers would.
+ */
+template <typename T>
+class sycl_future {
+  cl::sycl::event m_event;
+  std::vector<std::shared_ptr<void>> m_buffers;
+  std::function<T()> m_result;
+
+ public:
+  sycl_future(cl::sycl::event event, std::function<T()> result)
+      : m_event(event), m_result(result) {}
+
+  sycl_future(sycl_future &&) = default;
+  sycl_future &operator=(sycl_future &&) = default;
+  sycl_future(const sycl_future &) = delete;
+  sycl_future &operator=(const sycl_future &) = delete;
+
+  /* keep.
+   * @brief Keeps a copy of the buffer until the handle is waited for
+   */
+  template <typename Buffer>
+  void keep(Buffer buf) {
+    m_buffers.push_back(std::make_shared<Buffer>(buf));
+  }
+
+  // Returns the event of the last command group of the algorithm
+  cl::sycl::event get_event() const { return m_event; }
+
+  /* wait.
+   * @brief Waits for the algorithm, then releases the buffers so the data
+   * is copied back to the host
+   */
+  void wait() {
+    m_event.wait_and_throw();
+    m_buffers.clear();
+  }
+
+  /* get.
+   * @brief Waits for the algorithm and returns its result
+   */
+  T get() {
+    wait();
+    return m_result();
+  }
+};
+
+/* make_sycl_future.
+ * @brief Builds the handle of an algorithm from its event, the function
+ * returning its result and the buffers to keep alive
+ */
+template <typename T, typename... Buffers>
+sycl_future<T> make_sycl_future(cl::sycl::event event,
+                                std::function<T()> result,
+                                Buffers... buffers) {
+  sycl_future<T> f(event, result);
+  int expand[] = {0, (f.keep(buffers), 0)...};
+  (void)expand;
+  return f;
+}
+
+/* submit_marker.
+ * @brief Submits a command group that only reads the buffer: its event is
+ * complete once all the command groups writing to the buffer before it are.
+ * It gives a single event to the algorithms submitting several kernels.
+ */
+template <typename KernelName, typename Buffer>
+cl::sycl::event submit_marker(cl::sycl::queue q, Buffer buf) {
+  return q.submit([&](cl::sycl::handler &h) {
+    auto a = buf.template get_access<cl::sycl::access::mode::read>(h);
+    h.single_task<KernelName>([a]() {});
+  });
+}
+
+}  // namespace helpers
+}  // namespace sycl
+
+#endif  // __EXPERIMENTAL_DETAIL_SYCL_FUTURE__
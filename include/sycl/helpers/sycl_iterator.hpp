@@ -199,6 +199,19 @@ class BufferIterator : public SyclIterator {
     return tmp;
   }
 
+  // Prefix operator (Decrement and return value)
+  BufferIterator<T, Alloc> &operator--() {
+    this->pos_--;
+    return (*this);
+  }
+
+  // Postfix operator (Return value and decrement)
+  BufferIterator<T, Alloc> operator--(int i) {
+    BufferIterator<T, Alloc> tmp(*this);
+    this->pos_ -= 1;
+    return tmp;
+  }
+
   reference operator*() = delete;
 
   pointer operator->() = delete;
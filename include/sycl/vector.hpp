@@ -0,0 +1,296 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and/or associated documentation files (the
+   "Materials"), to deal in the Materials without restriction, including
+   without limitation the rights to use, copy, modify, merge, publish,
+   distribute, sublicense, and/or sell copies of the Materials, and to
+   permit persons to whom the Materials are furnished to do so, subject to
+   the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Materials.
+
+   MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+   KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+   SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+    https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+
+*/
+
+/**
+ * @file
+ * @brief Device-resident container
+ * @detail sycl::vector owns a buffer whose data stays on the device: its
+ *    iterators are BufferIterators, so the algorithms called on a
+ *    sycl::vector reuse its buffer and nothing is copied back to the host
+ *    between two calls. The host reads and writes the data through views
+ *    holding a host accessor.
+ */
+
+#ifndef __SYCL_VECTOR__
+#define __SYCL_VECTOR__
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <CL/sycl.hpp>
+#include <sycl/helpers/sycl_iterator.hpp>
+#include <sycl/helpers/sycl_namegen.hpp>
+
+/** vector_name.
+ * Class used to name the kernels of sycl::vector per element type.
+ */
+template <typename T>
+class vector_name {
+  T userGivenKernelName;
+};
+
+namespace sycl {
+
+/** host_view.
+ * Host access to the elements of a sycl::vector. The view holds a host
+ * accessor, so the device cannot use the vector while the view is alive.
+ */
+template <typename T, cl::sycl::access::mode Mode>
+class host_view {
+  helpers::sycl_host_acc<T, Mode> acc_;
+  size_t size_;
+
+ public:
+  typedef helpers::HostAccessorIterator<T, Mode> iterator;
+
+  host_view(helpers::sycl_host_acc<T, Mode> acc, size_t size)
+      : acc_(acc), size_(size) {}
+
+  size_t size() const { return size_; }
+
+  iterator begin() { return iterator(acc_, 0); }
+
+  iterator end() { return iterator(acc_, size_); }
+
+  auto operator[](size_t pos) const -> decltype(acc_[pos]) {
+    return acc_[pos];
+  }
+};
+
+/** vector.
+ * Container whose elements live in a buffer. The buffer holds capacity()
+ * elements, the first size() of which are those of the vector: growing past
+ * the capacity allocates a buffer at least twice as large and copies the
+ * elements on the device, so appending is amortised.
+ * An empty vector keeps a buffer of one element, so that its iterators
+ * still refer to a buffer.
+ */
+template <typename T>
+class vector {
+ public:
+  typedef T value_type;
+  typedef typename cl::sycl::buffer<T, 1>::allocator_type allocator_type;
+  typedef helpers::BufferIterator<T, allocator_type> iterator;
+
+ private:
+  typedef cl::sycl::helpers::NameGen<0, vector_name<T>> CopyName;
+  typedef cl::sycl::helpers::NameGen<1, vector_name<T>> FillName;
+
+  cl::sycl::queue q_;
+  cl::sycl::buffer<T, 1> buf_;
+  size_t size_;
+
+  static cl::sycl::buffer<T, 1> allocate(size_t size) {
+    return cl::sycl::buffer<T, 1>(
+        cl::sycl::range<1>(std::max(size, static_cast<size_t>(1))));
+  }
+
+  /* Copies count elements of src to dst on the device */
+  void copy(cl::sycl::buffer<T, 1> &src, cl::sycl::buffer<T, 1> &dst,
+            size_t count) {
+    if (count == 0) {
+      return;
+    }
+    q_.submit([&](cl::sycl::handler &h) {
+      auto aS = src.template get_access<cl::sycl::access::mode::read>(h);
+      auto aD = dst.template get_access<cl::sycl::access::mode::write>(h);
+      h.parallel_for<CopyName>(
+          cl::sycl::range<1>{count},
+          [aS, aD](cl::sycl::id<1> id) { aD[id] = aS[id]; });
+    });
+  }
+
+  /* Sets the elements [first, last) to value on the device */
+  void fill(size_t first, size_t last, const T &value) {
+    if (first >= last) {
+      return;
+    }
+    q_.submit([&](cl::sycl::handler &h) {
+      auto aD = buf_.template get_access<cl::sycl::access::mode::write>(h);
+      T v = value;
+      h.parallel_for<FillName>(
+          cl::sycl::range<1>{last - first},
+          [aD, v, first](cl::sycl::id<1> id) { aD[id[0] + first] = v; });
+    });
+  }
+
+  /* Changes the capacity to at least count, keeping the elements */
+  void reallocate(size_t count) {
+    if (count <= capacity()) {
+      return;
+    }
+    cl::sycl::buffer<T, 1> buf = allocate(count);
+    copy(buf_, buf, size_);
+    buf_ = buf;
+  }
+
+  /* Changes the size, growing the capacity geometrically */
+  void grow(size_t size) {
+    if (size > capacity()) {
+      reallocate(std::max(size, 2 * capacity()));
+    }
+    size_ = size;
+  }
+
+  /* Copies the host range to the elements starting at pos */
+  template <class ForwardIt>
+  void write(size_t pos, ForwardIt first, ForwardIt last) {
+    size_t count = std::distance(first, last);
+    if (count == 0) {
+      return;
+    }
+    auto h = buf_.template get_access<cl::sycl::access::mode::write>(
+        cl::sycl::range<1>(count), cl::sycl::id<1>(pos));
+    for (size_t i = 0; first != last; ++first, ++i) {
+      h[i] = *first;
+    }
+  }
+
+ public:
+  explicit vector(cl::sycl::queue q = cl::sycl::queue())
+      : q_(q), buf_(allocate(0)), size_(0) {}
+
+  vector(size_t size, const T &value,
+         cl::sycl::queue q = cl::sycl::queue())
+      : q_(q), buf_(allocate(size)), size_(size) {
+    fill(0, size, value);
+  }
+
+  template <class ForwardIt,
+            typename = typename std::iterator_traits<
+                ForwardIt>::iterator_category>
+  vector(ForwardIt first, ForwardIt last,
+         cl::sycl::queue q = cl::sycl::queue())
+      : q_(q), buf_(allocate(0)), size_(0) {
+    assign(first, last);
+  }
+
+  vector(const vector &other)
+      : q_(other.q_), buf_(allocate(other.size_)), size_(other.size_) {
+    cl::sycl::buffer<T, 1> src = other.buf_;
+    copy(src, buf_, size_);
+  }
+
+  vector &operator=(const vector &other) {
+    if (this != &other) {
+      if (other.size_ > capacity()) {
+        buf_ = allocate(other.size_);
+      }
+      cl::sycl::buffer<T, 1> src = other.buf_;
+      copy(src, buf_, other.size_);
+      size_ = other.size_;
+    }
+    return *this;
+  }
+
+  size_t size() const { return size_; }
+
+  size_t capacity() const { return buf_.get_count(); }
+
+  /* reserve.
+   * @brief Makes room for count elements, without changing the size.
+   */
+  void reserve(size_t count) { reallocate(count); }
+
+  bool empty() const { return size_ == 0; }
+
+  cl::sycl::queue get_queue() const { return q_; }
+
+  /* get_buffer.
+   * @brief Buffer whose first size() elements are those of the vector. It
+   * is replaced when the size grows past the capacity.
+   */
+  cl::sycl::buffer<T, 1> get_buffer() const { return buf_; }
+
+  iterator begin() { return iterator(buf_, 0); }
+
+  iterator end() { return iterator(buf_, size_); }
+
+  /* resize.
+   * @brief Changes the number of elements, the new elements are set to
+   * value.
+   */
+  void resize(size_t size, const T &value = T()) {
+    size_t old_size = size_;
+    grow(size);
+    fill(old_size, size, value);
+  }
+
+  void clear() { size_ = 0; }
+
+  /* assign.
+   * @brief Replaces the elements with the host range [first, last).
+   */
+  template <class ForwardIt>
+  void assign(ForwardIt first, ForwardIt last) {
+    size_t count = std::distance(first, last);
+    if (count > capacity()) {
+      buf_ = allocate(count);
+    }
+    size_ = count;
+    write(0, first, last);
+  }
+
+  void assign(size_t size, const T &value) {
+    if (size > capacity()) {
+      buf_ = allocate(size);
+    }
+    size_ = size;
+    fill(0, size, value);
+  }
+
+  /* push_back.
+   * @brief Appends the host range [first, last), copying the existing
+   * elements on the device only when the capacity is exceeded.
+   */
+  template <class ForwardIt,
+            typename = typename std::iterator_traits<
+                ForwardIt>::iterator_category>
+  void push_back(ForwardIt first, ForwardIt last) {
+    size_t old_size = size_;
+    grow(size_ + std::distance(first, last));
+    write(old_size, first, last);
+  }
+
+  void push_back(const T &value) { push_back(&value, &value + 1); }
+
+  /* get_host_view.
+   * @brief Host access to the elements, waiting for the kernels using
+   * the vector.
+   */
+  template <cl::sycl::access::mode Mode = cl::sycl::access::mode::read>
+  sycl::host_view<T, Mode> get_host_view() {
+    return sycl::host_view<T, Mode>(
+        buf_.template get_access<Mode>(), size_);
+  }
+};
+
+}  // namespace sycl
+
+#endif  // __SYCL_VECTOR__
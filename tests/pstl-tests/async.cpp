@@ -0,0 +1,138 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct AsyncAlgorithm : public testing::Test {};
+
+TEST_F(AsyncAlgorithm, TestSyclAsyncTransform) {
+  std::vector<int> v(1000);
+  std::iota(v.begin(), v.end(), 0);
+  std::vector<int> out(v.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class AsyncTransformAlgorithm> snp(q);
+  auto f = async_transform(snp, v.begin(), v.end(), out.begin(),
+                           [](int x) { return 2 * x; });
+  auto last = f.get();
+
+  EXPECT_TRUE(last == out.end());
+  for (size_t i = 0; i < v.size(); ++i) {
+    EXPECT_EQ(2 * v[i], out[i]);
+  }
+}
+
+TEST_F(AsyncAlgorithm, TestSyclAsyncForEachAndFill) {
+  std::vector<int> v(1000, 1);
+  std::vector<int> w(333, 0);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class AsyncForEachAlgorithm> snp1(q);
+  sycl::sycl_execution_policy<class AsyncFillAlgorithm> snp2(q);
+  auto f1 = async_for_each(snp1, v.begin(), v.end(), [](int &x) { x += 1; });
+  auto f2 = async_fill(snp2, w.begin(), w.end(), 7);
+  f2.wait();
+  f1.wait();
+
+  EXPECT_TRUE(std::all_of(v.begin(), v.end(), [](int x) { return x == 2; }));
+  EXPECT_TRUE(std::all_of(w.begin(), w.end(), [](int x) { return x == 7; }));
+}
+
+TEST_F(AsyncAlgorithm, TestSyclAsyncReduce) {
+  std::vector<int> v(10000);
+  std::iota(v.begin(), v.end(), 0);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class AsyncReduceAlgorithm> snp(q);
+  auto f = async_reduce(snp, v.begin(), v.end(), 5,
+                        [](int a, int b) { return a + b; });
+
+  EXPECT_EQ(std::accumulate(v.begin(), v.end(), 5), f.get());
+}
+
+TEST_F(AsyncAlgorithm, TestSyclAsyncSort) {
+  std::vector<int> v(1000);
+  std::generate(v.begin(), v.end(), std::rand);
+  std::vector<int> w(v);
+  std::vector<int> expected(v);
+  std::sort(expected.begin(), expected.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class AsyncSortAlgorithm> snp(q);
+  auto f1 = async_sort(snp, v.begin(), v.end());
+  auto f2 = async_sort(snp, w.begin(), w.end(),
+                       [](int a, int b) { return a > b; });
+  f1.wait();
+  f2.wait();
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  EXPECT_TRUE(std::equal(w.begin(), w.end(), expected.begin()));
+}
+
+TEST_F(AsyncAlgorithm, TestSyclAsyncInclusiveScan) {
+  std::vector<int> v(1000, 1);
+  std::vector<int> out(v.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class AsyncInclusiveScanAlgorithm> snp(q);
+  auto f = async_inclusive_scan(snp, v.begin(), v.end(), out.begin());
+  auto last = f.get();
+
+  EXPECT_TRUE(last == out.end());
+  for (size_t i = 0; i < out.size(); ++i) {
+    EXPECT_EQ(static_cast<int>(i + 1), out[i]);
+  }
+  // the input range is left untouched
+  EXPECT_TRUE(std::all_of(v.begin(), v.end(), [](int x) { return x == 1; }));
+}
+
+TEST_F(AsyncAlgorithm, TestSyclAsyncInclusiveScanNoInit) {
+  // several tiles, so the first one is the only one without a prefix
+  std::vector<int> v(5000, 1);
+  v[0] = 3;
+  v[3000] = 2;
+  std::vector<int> out(v.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class AsyncInclusiveScanNoInitAlgorithm> snp(q);
+  // the scan starts from v[0], not from the int 0
+  auto f = async_inclusive_scan(snp, v.begin(), v.end(), out.begin(),
+                                [](int a, int b) { return a * b; });
+  f.wait();
+
+  for (size_t i = 0; i < out.size(); ++i) {
+    EXPECT_EQ(i < 3000 ? 3 : 6, out[i]);
+  }
+}
@@ -0,0 +1,68 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+
+#include <sycl/execution_policy>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+struct BufferMapScanHelper : public testing::Test {};
+
+TEST_F(BufferMapScanHelper, TestMultiLevelScan) {
+  // tiles of 4 elements, so the totals of the 25 work-groups are scanned in
+  // 6 tiles, then 2, then 1
+  sycl::impl::sycl_algorithm_descriptor d(100, 4, 2, 25, 2);
+  size_t levels = 1;
+  for (auto t = d; t.nb_work_group > 1;
+       t = sycl::impl::mapscan_totals_descriptor(t)) {
+    levels++;
+  }
+  EXPECT_EQ(4u, levels);
+
+  std::vector<int> v(d.size);
+  for (size_t i = 0; i < v.size(); ++i) {
+    v[i] = static_cast<int>(i % 7);
+  }
+  std::vector<int> out(v.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MultiLevelScanAlgorithm> snp(q);
+  {
+    cl::sycl::buffer<int, 1> bufI(v.data(), cl::sycl::range<1>(v.size()));
+    cl::sycl::buffer<int, 1> bufO(out.data(), cl::sycl::range<1>(out.size()));
+    sycl::impl::buffer_mapscan(snp, q, bufI, bufO, 10, d,
+                               [](int x) { return 2 * x; },
+                               [](int a, int b) { return a + b; });
+  }
+
+  int expected = 10;
+  for (size_t i = 0; i < v.size(); ++i) {
+    expected += 2 * v[i];
+    EXPECT_EQ(expected, out[i]);
+  }
+}
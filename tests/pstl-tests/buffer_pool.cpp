@@ -0,0 +1,78 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct BufferPoolAlgorithm : public testing::Test {};
+
+TEST_F(BufferPoolAlgorithm, TestSizeClass) {
+  using sycl::helpers::detail::temp_buffer_size_class;
+  EXPECT_EQ(temp_buffer_size_class(1), 1u);
+  EXPECT_EQ(temp_buffer_size_class(3), 4u);
+  EXPECT_EQ(temp_buffer_size_class(64), 64u);
+  EXPECT_EQ(temp_buffer_size_class(65), 128u);
+}
+
+TEST_F(BufferPoolAlgorithm, TestTempBufferReuse) {
+  typedef cl::sycl::access::mode mode;
+  float *first = nullptr;
+  {
+    auto buf = sycl::helpers::make_temp_buffer<float>(100);
+    EXPECT_EQ(buf.get_count(), 100u);
+    first = buf.get_access<mode::read_write>().get_pointer();
+  }
+  // 120 elements are in the same size class as 100
+  auto buf = sycl::helpers::make_temp_buffer<float>(120);
+  EXPECT_EQ(buf.get_count(), 120u);
+  EXPECT_EQ(buf.get_access<mode::read_write>().get_pointer(), first);
+
+  // the block is in use, so another one is allocated
+  auto other = sycl::helpers::make_temp_buffer<float>(120);
+  EXPECT_NE(other.get_access<mode::read_write>().get_pointer(), first);
+}
+
+TEST_F(BufferPoolAlgorithm, TestSyclRepeatedReduce) {
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class RepeatedReduceAlgorithm> snp(q);
+
+  for (size_t size = 1; size <= 4096; size *= 4) {
+    std::vector<int> v(size);
+    std::iota(v.begin(), v.end(), 1);
+    int expected = std::accumulate(v.begin(), v.end(), 0);
+    for (int i = 0; i < 3; i++) {
+      EXPECT_EQ(reduce(snp, v.begin(), v.end()), expected);
+    }
+  }
+}
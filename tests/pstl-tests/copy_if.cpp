@@ -0,0 +1,132 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct CopyIfAlgorithm : public testing::Test {};
+
+struct IsOdd {
+  bool operator()(int x) const { return (x % 2) != 0; }
+};
+
+TEST_F(CopyIfAlgorithm, TestSyclCopyIf) {
+  for (size_t size : {1, 2, 17, 1000, 5001}) {
+    std::vector<int> v(size);
+    std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+    std::vector<int> expected;
+    std::copy_if(v.begin(), v.end(), std::back_inserter(expected),
+                 [](int x) { return x < 30; });
+    std::vector<int> out(size, -1);
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class CopyIfAlgorithm1> snp(q);
+    auto last = copy_if(snp, v.begin(), v.end(), out.begin(),
+                        [](int x) { return x < 30; });
+
+    EXPECT_EQ(std::distance(out.begin(), last), expected.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+    EXPECT_TRUE(std::all_of(last, out.end(), [](int x) { return x == -1; }));
+  }
+}
+
+TEST_F(CopyIfAlgorithm, TestSyclCopyIfNone) {
+  std::vector<int> v = {2, 4, 6, 8};
+  std::vector<int> out(v.size(), -1);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class CopyIfAlgorithm2> snp(q);
+  auto last = copy_if(snp, v.begin(), v.end(), out.begin(),
+                      [](int x) { return x > 10; });
+
+  EXPECT_TRUE(last == out.begin());
+}
+
+TEST_F(CopyIfAlgorithm, TestSyclRemoveCopyIf) {
+  std::vector<int> v(3000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+  std::vector<int> expected;
+  std::remove_copy_if(v.begin(), v.end(), std::back_inserter(expected),
+                      IsOdd());
+  std::vector<int> out(v.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<> snp(q);
+  auto last = remove_copy_if(snp, v.begin(), v.end(), out.begin(), IsOdd());
+
+  EXPECT_EQ(std::distance(out.begin(), last), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+}
+
+TEST_F(CopyIfAlgorithm, TestSyclRemoveIf) {
+  std::vector<int> v(3000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+  std::vector<int> expected(v);
+  expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                [](int x) { return x >= 50; }),
+                 expected.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class CopyIfAlgorithm4> snp(q);
+  auto last = remove_if(snp, v.begin(), v.end(),
+                        [](int x) { return x >= 50; });
+
+  EXPECT_EQ(std::distance(v.begin(), last), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), v.begin()));
+}
+
+TEST_F(CopyIfAlgorithm, TestSyclPartitionCopy) {
+  std::vector<int> v(2500);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+  std::vector<int> expected_true;
+  std::vector<int> expected_false;
+  std::partition_copy(v.begin(), v.end(), std::back_inserter(expected_true),
+                      std::back_inserter(expected_false), IsOdd());
+  std::vector<int> out_true(v.size());
+  std::vector<int> out_false(v.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class CopyIfAlgorithm5> snp(q);
+  auto res = partition_copy(snp, v.begin(), v.end(), out_true.begin(),
+                            out_false.begin(), IsOdd());
+
+  EXPECT_EQ(std::distance(out_true.begin(), res.first),
+            expected_true.size());
+  EXPECT_EQ(std::distance(out_false.begin(), res.second),
+            expected_false.size());
+  EXPECT_TRUE(std::equal(expected_true.begin(), expected_true.end(),
+                         out_true.begin()));
+  EXPECT_TRUE(std::equal(expected_false.begin(), expected_false.end(),
+                         out_false.begin()));
+}
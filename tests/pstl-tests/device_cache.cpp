@@ -0,0 +1,151 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct DeviceCacheAlgorithm : public testing::Test {};
+
+TEST_F(DeviceCacheAlgorithm, TestSyclDeviceCacheChain) {
+  std::vector<int> v(512);
+  std::iota(v.begin(), v.end(), 0);
+  std::vector<int> expected(v.size());
+  std::transform(v.begin(), v.end(), expected.begin(),
+                 [](int x) { return 2 * x + 1; });
+  int sum = std::accumulate(expected.begin(), expected.end(), 0);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class DeviceCacheTransform1> snp1(q);
+  sycl::sycl_execution_policy<class DeviceCacheTransform2> snp2(q);
+  sycl::sycl_execution_policy<class DeviceCacheReduce> snp3(q);
+  {
+    sycl::helpers::device_cache cache;
+    EXPECT_EQ(sycl::helpers::device_cache::active(), &cache);
+    transform(snp1, v.begin(), v.end(), v.begin(),
+              [](int x) { return 2 * x; });
+    transform(snp2, v.begin(), v.end(), v.begin(),
+              [](int x) { return x + 1; });
+    EXPECT_EQ(reduce(snp3, v.begin(), v.end()), sum);
+  }
+  EXPECT_EQ(sycl::helpers::device_cache::active(), nullptr);
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+TEST_F(DeviceCacheAlgorithm, TestSyclDeviceCacheRanges) {
+  std::vector<float> v(1000, 1.0f);
+  std::vector<float> expected(v);
+  std::fill(expected.begin() + 100, expected.begin() + 200, 2.0f);
+  std::fill(expected.begin() + 150, expected.begin() + 250, 3.0f);
+  std::fill(expected.begin() + 900, expected.end(), 4.0f);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class DeviceCacheFill> snp(q);
+  {
+    sycl::helpers::device_cache cache;
+    fill(snp, v.begin(), v.end(), 1.0f);
+    // inside the cached range
+    fill(snp, v.begin() + 100, v.begin() + 200, 2.0f);
+    {
+      sycl::helpers::device_cache inner;
+      EXPECT_EQ(sycl::helpers::device_cache::active(), &cache);
+      fill(snp, v.begin() + 900, v.end(), 4.0f);
+    }
+    // overlapping the cached range, which is flushed first
+    fill(snp, v.begin() + 150, v.begin() + 250, 3.0f);
+    cache.flush();
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  }
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+TEST_F(DeviceCacheAlgorithm, TestSyclDeviceCacheInPlace) {
+  std::vector<int> v(600);
+  for (size_t i = 0; i < v.size(); i++) {
+    v[i] = (i / 3) % 7;
+  }
+  std::vector<int> expected(v);
+  auto expected_last =
+      std::remove_if(expected.begin(), expected.end(),
+                     [](int x) { return x == 2; });
+  expected_last = std::unique(expected.begin(), expected_last);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class DeviceCacheRemoveIf> snp1(q);
+  sycl::sycl_execution_policy<class DeviceCacheUnique> snp2(q);
+  std::vector<int>::iterator last;
+  {
+    sycl::helpers::device_cache cache;
+    last = remove_if(snp1, v.begin(), v.end(),
+                     [](int x) { return x == 2; });
+    last = unique(snp2, v.begin(), last);
+  }
+  ASSERT_EQ(last - v.begin(), expected_last - expected.begin());
+  EXPECT_TRUE(std::equal(v.begin(), last, expected.begin()));
+}
+
+TEST_F(DeviceCacheAlgorithm, TestSyclDeviceCacheScanInput) {
+  std::vector<int> v(512);
+  std::iota(v.begin(), v.end(), 1);
+  std::vector<int> inclusive(v.size());
+  std::vector<int> exclusive(v.size());
+  std::vector<int> expected_inclusive(v.size());
+  std::partial_sum(v.begin(), v.end(), expected_inclusive.begin());
+  std::vector<int> expected_exclusive(v.size());
+  for (size_t i = 0; i < v.size(); i++) {
+    expected_inclusive[i] += 10;
+    expected_exclusive[i] = expected_inclusive[i] - v[i];
+  }
+  std::vector<int> expected(v.size());
+  std::transform(v.begin(), v.end(), expected.begin(),
+                 [](int x) { return x + 1; });
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class DeviceCacheInclusiveScan> snp1(q);
+  sycl::sycl_execution_policy<class DeviceCacheExclusiveScan> snp2(q);
+  sycl::sycl_execution_policy<class DeviceCacheScanTransform> snp3(q);
+  {
+    sycl::helpers::device_cache cache;
+    inclusive_scan(snp1, v.begin(), v.end(), inclusive.begin(),
+                   [](int x, int y) { return x + y; }, 10);
+    exclusive_scan(snp2, v.begin(), v.end(), exclusive.begin(), 10);
+    // the scans must leave the cached input untouched
+    transform(snp3, v.begin(), v.end(), v.begin(),
+              [](int x) { return x + 1; });
+  }
+  EXPECT_TRUE(std::equal(inclusive.begin(), inclusive.end(),
+                         expected_inclusive.begin()));
+  EXPECT_TRUE(std::equal(exclusive.begin(), exclusive.end(),
+                         expected_exclusive.begin()));
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
@@ -0,0 +1,72 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <sycl/execution_policy>
+#include <sycl/helpers/sycl_device_info.hpp>
+#include <sycl/algorithm/buffer_algorithms.hpp>
+
+struct DeviceInfoHelper : public testing::Test {};
+
+TEST_F(DeviceInfoHelper, TestDeviceInfoMatchesQueries) {
+  cl::sycl::queue q;
+  auto device = q.get_device();
+  auto info = sycl::helpers::get_device_info(device);
+  const cl::sycl::id<3> max_work_item_sizes =
+      device.get_info<cl::sycl::info::device::max_work_item_sizes>();
+
+  EXPECT_EQ(info.max_compute_units,
+            device.get_info<cl::sycl::info::device::max_compute_units>());
+  EXPECT_EQ(info.max_work_group_size,
+            std::min(static_cast<size_t>(device.get_info<
+                         cl::sycl::info::device::max_work_group_size>()),
+                     static_cast<size_t>(max_work_item_sizes[0])));
+  EXPECT_EQ(info.local_mem_size,
+            device.get_info<cl::sycl::info::device::local_mem_size>());
+  EXPECT_EQ(sycl::helpers::get_device_info(device).key, info.key);
+}
+
+TEST_F(DeviceInfoHelper, TestMemoisedDescriptors) {
+  cl::sycl::queue q;
+  auto device = q.get_device();
+  auto info = sycl::helpers::get_device_info(device);
+  for (size_t size : {1, 100, 5000, 100000}) {
+    for (int pass = 0; pass < 2; pass++) {
+      auto d = sycl::impl::compute_mapreduce_descriptor(device, size, 4);
+      auto e = sycl::impl::compute_mapreduce_descriptor(info, size, 4);
+      EXPECT_EQ(d.nb_work_group, e.nb_work_group);
+      EXPECT_EQ(d.nb_work_item, e.nb_work_item);
+      EXPECT_EQ(d.size_per_work_group, e.size_per_work_group);
+
+      d = sycl::impl::compute_mapscan_descriptor(device, size, 8);
+      e = sycl::impl::compute_mapscan_descriptor(info, size, 8);
+      EXPECT_EQ(d.nb_work_group, e.nb_work_group);
+      EXPECT_EQ(d.nb_work_item, e.nb_work_item);
+      EXPECT_EQ(d.size_per_work_group, e.size_per_work_group);
+    }
+  }
+}
@@ -220,3 +220,19 @@ TEST_F(ExclusiveScanAlgorithm, TestSyclExclusiveScanNonPowerOfTwoRange) {
     EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
   }
 }
+
+// test of an input spread over many work-groups, with an initial value
+TEST_F(ExclusiveScanAlgorithm, TestSyclExclusiveScanManyWorkGroups) {
+  std::vector<int> v(20011);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+  std::vector<int> gold(v);
+
+  exclusive_scan_gold(gold, 7, [](int a, int b) { return a + b; });
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ExclusiveScanAlgorithmMWG> snp(q);
+  exclusive_scan(snp, v.begin(), v.end(), v.begin(), 7,
+                 [](int a, int b) { return a + b; });
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
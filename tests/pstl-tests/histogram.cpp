@@ -0,0 +1,94 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct HistogramAlgorithm : public testing::Test {};
+
+TEST_F(HistogramAlgorithm, TestSyclHistogram) {
+  for (size_t size : {0, 1, 17, 1000, 5001}) {
+    std::vector<int> v(size);
+    std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+    std::vector<int> expected(10, 0);
+    for (int x : v) {
+      expected[x / 10]++;
+    }
+    std::vector<int> bins(10, -1);
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class HistogramAlgorithm1> snp(q);
+    auto last = histogram(snp, v.begin(), v.end(), bins.begin(), bins.size(),
+                          [](int x) { return static_cast<size_t>(x / 10); });
+
+    EXPECT_TRUE(last == bins.end());
+    EXPECT_TRUE(std::equal(bins.begin(), bins.end(), expected.begin()));
+  }
+}
+
+TEST_F(HistogramAlgorithm, TestSyclHistogramOutOfRange) {
+  std::vector<int> v(3000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+  std::vector<size_t> expected(5, 0);
+  for (int x : v) {
+    if (x < 50) {
+      expected[x / 10]++;
+    }
+  }
+  std::vector<size_t> bins(5);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class HistogramAlgorithm2> snp(q);
+  histogram(snp, v.begin(), v.end(), bins.begin(), bins.size(),
+            [](int x) { return static_cast<size_t>(x / 10); });
+
+  EXPECT_TRUE(std::equal(bins.begin(), bins.end(), expected.begin()));
+}
+
+TEST_F(HistogramAlgorithm, TestSyclHistogramManyBins) {
+  // more bins than fit in the local memory of a work-group
+  std::vector<int> v(20000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100000; });
+  std::vector<int> expected(100000, 0);
+  for (int x : v) {
+    expected[x]++;
+  }
+  std::vector<int> bins(expected.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class HistogramAlgorithm3> snp(q);
+  histogram(snp, v.begin(), v.end(), bins.begin(), bins.size(),
+            [](int x) { return static_cast<size_t>(x); });
+
+  EXPECT_TRUE(std::equal(bins.begin(), bins.end(), expected.begin()));
+}
@@ -244,3 +244,20 @@ TEST_F(InclusiveScanAlgorithm, TestSyclInclusiveScanNonPowerOfTwoRange) {
     EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
   }
 }
+
+// test of an input spread over many work-groups, with an initial value
+TEST_F(InclusiveScanAlgorithm, TestSyclInclusiveScanManyWorkGroups) {
+  std::vector<int> v(20011);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+  std::vector<int> gold(v);
+
+  inclusive_scan_gold(gold, 7, std::plus<int>());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class InclusiveScanAlgorithmMWG> snp(q);
+
+  inclusive_scan(snp, v.begin(), v.end(), v.begin(),
+                 plus<int>(), 7);
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), gold.begin()));
+}
@@ -179,3 +179,17 @@ TEST_F(InnerProductAlgorithm, TestSycl8InnerProduct) {
 
   EXPECT_TRUE( (128*2) == value);
 }
+
+TEST_F(InnerProductAlgorithm, TestSyclLargeInnerProduct) {
+  std::vector<int> v1(5000);
+  std::vector<int> v2(5000);
+  std::generate(v1.begin(), v1.end(), [] { return std::rand() % 10; });
+  std::generate(v2.begin(), v2.end(), [] { return std::rand() % 10; });
+  int result = std::inner_product(v1.begin(), v1.end(), v2.begin(), 3);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SYCL5InnerProductAlgorithm> snp(q);
+  int value = inner_product(snp, v1.begin(), v1.end(), v2.begin(), 3);
+
+  EXPECT_EQ(result, value);
+}
@@ -0,0 +1,108 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <deque>
+#include <vector>
+#include <algorithm>
+
+#include <sycl/execution_policy>
+#include <sycl/vector.hpp>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct MakeBufferAlgorithm : public testing::Test {};
+
+TEST_F(MakeBufferAlgorithm, TestContiguousIterators) {
+  using sycl::helpers::is_contiguous_iterator;
+  EXPECT_TRUE(is_contiguous_iterator<int*>::value);
+  EXPECT_TRUE(is_contiguous_iterator<std::vector<float>::iterator>::value);
+  EXPECT_FALSE(is_contiguous_iterator<const int*>::value);
+  EXPECT_FALSE(is_contiguous_iterator<std::vector<bool>::iterator>::value);
+  EXPECT_FALSE(is_contiguous_iterator<std::deque<int>::iterator>::value);
+}
+
+TEST_F(MakeBufferAlgorithm, TestSyclMakeBufferVector) {
+  std::vector<int> v = {1, 2, 3, 4, 5, 6, 7, 8};
+  std::vector<int> result = {2, 4, 6, 8, 10, 12, 14, 16};
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MakeBufferVectorAlgorithm> snp(q);
+  transform(snp, v.begin(), v.end(), v.begin(), [](int x) { return 2 * x; });
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), result.begin()));
+}
+
+TEST_F(MakeBufferAlgorithm, TestSyclMakeBufferPointer) {
+  int v[] = {1, 2, 3, 4, 5, 6, 7, 8};
+  int result[] = {1, 2, 3, 7, 7, 7, 7, 8};
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MakeBufferPointerAlgorithm> snp(q);
+  fill(snp, v + 3, v + 7, 7);
+
+  EXPECT_TRUE(std::equal(v, v + 8, result));
+}
+
+TEST_F(MakeBufferAlgorithm, TestSyclMakeBufferDeque) {
+  std::deque<int> v = {1, 2, 3, 4, 5, 6, 7, 8};
+  std::vector<int> result = {7, 7, 7, 7, 7, 7, 7, 7};
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MakeBufferDequeAlgorithm> snp(q);
+  fill(snp, v.begin(), v.end(), 7);
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), result.begin()));
+}
+
+TEST_F(MakeBufferAlgorithm, TestSyclMakeBufferUnaligned) {
+  std::vector<int> v(256);
+  for (size_t i = 0; i < v.size(); ++i) {
+    v[i] = static_cast<int>(i);
+  }
+  cl::sycl::queue q;
+  sycl::vector<int> dv(v.begin(), v.end(), q);
+  const size_t alignment = sycl::helpers::get_sub_buffer_alignment();
+  const size_t aligned = alignment / sizeof(int);
+
+  // an aligned range is a sub-buffer, an unaligned one a copy of the range
+  {
+    auto buf = sycl::helpers::make_buffer(dv.begin() + aligned, dv.end());
+    EXPECT_EQ(buf.get_count(), v.size() - aligned);
+    auto copy = sycl::helpers::make_buffer(dv.begin() + 1, dv.begin() + 3);
+    EXPECT_EQ(copy.get_count(), 2u);
+    auto a = copy.template get_access<cl::sycl::access::mode::read_write>();
+    EXPECT_EQ(a[0], 1);
+    EXPECT_EQ(a[1], 2);
+    a[0] = -1;
+  }
+  // the copy is written back once released
+  auto view = dv.get_host_view();
+  EXPECT_EQ(view[1], -1);
+  EXPECT_EQ(view[2], 2);
+}
@@ -0,0 +1,111 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct MinMaxElementAlgorithm : public testing::Test {};
+
+struct AbsLess {
+  bool operator()(int a, int b) const { return std::abs(a) < std::abs(b); }
+};
+
+TEST_F(MinMaxElementAlgorithm, TestSyclMinElement) {
+  for (size_t size : {1, 2, 17, 1000, 5001}) {
+    std::vector<int> v(size);
+    std::generate(v.begin(), v.end(), []() { return std::rand() % 50; });
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class MinMaxElementAlgorithm1> snp(q);
+    auto it = min_element(snp, v.begin(), v.end());
+
+    EXPECT_TRUE(it == std::min_element(v.begin(), v.end()));
+  }
+}
+
+TEST_F(MinMaxElementAlgorithm, TestSyclMaxElement) {
+  for (size_t size : {1, 2, 17, 1000, 5001}) {
+    std::vector<int> v(size);
+    std::generate(v.begin(), v.end(), []() { return std::rand() % 50; });
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class MinMaxElementAlgorithm2> snp(q);
+    auto it = max_element(snp, v.begin(), v.end());
+
+    EXPECT_TRUE(it == std::max_element(v.begin(), v.end()));
+  }
+}
+
+TEST_F(MinMaxElementAlgorithm, TestSyclMinMaxElement) {
+  for (size_t size : {1, 2, 17, 1000, 5001}) {
+    std::vector<int> v(size);
+    std::generate(v.begin(), v.end(), []() { return std::rand() % 50; });
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class MinMaxElementAlgorithm3> snp(q);
+    auto res = minmax_element(snp, v.begin(), v.end());
+    auto expected = std::minmax_element(v.begin(), v.end());
+
+    EXPECT_TRUE(res.first == expected.first);
+    EXPECT_TRUE(res.second == expected.second);
+  }
+}
+
+TEST_F(MinMaxElementAlgorithm, TestSyclMinMaxElementComp) {
+  std::vector<int> v(3000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 201 - 100; });
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<> snp(q);
+  auto min_it = min_element(snp, v.begin(), v.end(), AbsLess());
+  auto max_it = max_element(snp, v.begin(), v.end(), AbsLess());
+  auto res = minmax_element(snp, v.begin(), v.end(), AbsLess());
+  auto expected = std::minmax_element(v.begin(), v.end(), AbsLess());
+
+  EXPECT_TRUE(min_it == std::min_element(v.begin(), v.end(), AbsLess()));
+  EXPECT_TRUE(max_it == std::max_element(v.begin(), v.end(), AbsLess()));
+  EXPECT_TRUE(res.first == expected.first);
+  EXPECT_TRUE(res.second == expected.second);
+}
+
+TEST_F(MinMaxElementAlgorithm, TestSyclMinMaxElementEmpty) {
+  std::vector<int> v;
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class MinMaxElementAlgorithm5> snp(q);
+  auto res = minmax_element(snp, v.begin(), v.end());
+
+  EXPECT_TRUE(min_element(snp, v.begin(), v.end()) == v.end());
+  EXPECT_TRUE(res.first == v.end());
+  EXPECT_TRUE(res.second == v.end());
+}
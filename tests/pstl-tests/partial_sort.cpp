@@ -0,0 +1,126 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct PartialSortAlgorithm : public testing::Test {};
+
+TEST_F(PartialSortAlgorithm, TestSyclTopK) {
+  for (size_t k : {1, 10, 100, 1000, 2000}) {
+    std::vector<int> v(1000);
+    std::generate(v.begin(), v.end(), std::rand);
+    std::vector<int> expected(v);
+    std::sort(expected.begin(), expected.end());
+    std::vector<int> out(std::min(k, v.size()));
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class PartialSortAlgorithm1> snp(q);
+    auto out_last = top_k(snp, v.begin(), v.end(), k, out.begin());
+
+    EXPECT_TRUE(out_last == out.end());
+    EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+  }
+}
+
+TEST_F(PartialSortAlgorithm, TestSyclTopKComp) {
+  std::vector<float> v(777);
+  std::generate(v.begin(), v.end(), std::rand);
+  std::vector<float> expected(v);
+  std::sort(expected.begin(), expected.end(), std::greater<float>());
+  std::vector<float> out(50);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class PartialSortAlgorithm2> snp(q);
+  // Largest elements first
+  top_k(snp, v.begin(), v.end(), out.size(), out.begin(),
+        [](float a, float b) { return a < b; });
+
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+}
+
+TEST_F(PartialSortAlgorithm, TestSyclTopKIsStable) {
+  std::vector<std::pair<int, int>> v(2000);
+  for (size_t i = 0; i < v.size(); ++i) {
+    v[i] = std::make_pair(std::rand() % 16, static_cast<int>(i));
+  }
+  std::vector<std::pair<int, int>> expected(v);
+  std::stable_sort(
+      expected.begin(), expected.end(),
+      [](std::pair<int, int> a, std::pair<int, int> b) {
+        return a.first < b.first;
+      });
+  std::vector<std::pair<int, int>> out(300);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class PartialSortAlgorithm5> snp(q);
+  top_k(snp, v.begin(), v.end(), out.size(), out.begin(),
+        [](std::pair<int, int> a, std::pair<int, int> b) {
+          return a.first > b.first;
+        });
+
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+}
+
+TEST_F(PartialSortAlgorithm, TestSyclPartialSort) {
+  std::vector<int> v(1000);
+  std::generate(v.begin(), v.end(), [] { return std::rand() % 100; });
+  std::vector<int> expected(v);
+  std::sort(expected.begin(), expected.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class PartialSortAlgorithm3> snp(q);
+  partial_sort(snp, v.begin(), v.begin() + 150, v.end());
+
+  EXPECT_TRUE(std::equal(v.begin(), v.begin() + 150, expected.begin()));
+  std::sort(v.begin() + 150, v.end());
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+TEST_F(PartialSortAlgorithm, TestSyclNthElement) {
+  std::vector<int> v(500);
+  std::generate(v.begin(), v.end(), std::rand);
+  std::vector<int> expected(v);
+  std::sort(expected.begin(), expected.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class PartialSortAlgorithm4> snp(q);
+  nth_element(snp, v.begin(), v.begin() + 42, v.end());
+
+  EXPECT_EQ(expected[42], v[42]);
+  for (size_t i = 43; i < v.size(); ++i) {
+    EXPECT_LE(v[42], v[i]);
+  }
+}
@@ -0,0 +1,217 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct ReduceByKeyAlgorithm : public testing::Test {};
+
+TEST_F(ReduceByKeyAlgorithm, TestSyclReduceByKey) {
+  for (size_t size : {1, 2, 17, 1000, 5001}) {
+    std::vector<int> keys(size);
+    std::generate(keys.begin(), keys.end(), []() { return std::rand() % 3; });
+    std::vector<int> values(size);
+    std::generate(values.begin(), values.end(),
+                  []() { return std::rand() % 100; });
+    std::vector<int> expected_keys;
+    std::vector<int> expected_values;
+    for (size_t i = 0; i < size; ++i) {
+      if (i == 0 || keys[i] != keys[i - 1]) {
+        expected_keys.push_back(keys[i]);
+        expected_values.push_back(0);
+      }
+      expected_values.back() += values[i];
+    }
+    std::vector<int> keys_out(size);
+    std::vector<int> values_out(size);
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class ReduceByKeyAlgorithm1> snp(q);
+    auto res = reduce_by_key(snp, keys.begin(), keys.end(), values.begin(),
+                             keys_out.begin(), values_out.begin());
+
+    EXPECT_EQ(std::distance(keys_out.begin(), res.first),
+              expected_keys.size());
+    EXPECT_EQ(std::distance(values_out.begin(), res.second),
+              expected_values.size());
+    EXPECT_TRUE(std::equal(expected_keys.begin(), expected_keys.end(),
+                           keys_out.begin()));
+    EXPECT_TRUE(std::equal(expected_values.begin(), expected_values.end(),
+                           values_out.begin()));
+  }
+}
+
+TEST_F(ReduceByKeyAlgorithm, TestSyclReduceByKeyMax) {
+  std::vector<int> keys(3000);
+  std::generate(keys.begin(), keys.end(), []() { return std::rand() % 50; });
+  std::sort(keys.begin(), keys.end());
+  std::vector<float> values(keys.size());
+  std::generate(values.begin(), values.end(),
+                []() { return static_cast<float>(std::rand() % 1000); });
+  std::vector<int> expected_keys;
+  std::vector<float> expected_values;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (i == 0 || keys[i] / 10 != keys[i - 1] / 10) {
+      expected_keys.push_back(keys[i]);
+      expected_values.push_back(values[i]);
+    }
+    expected_values.back() = std::max(expected_values.back(), values[i]);
+  }
+  std::vector<int> keys_out(keys.size());
+  std::vector<float> values_out(keys.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ReduceByKeyAlgorithm2> snp(q);
+  auto res = reduce_by_key(
+      snp, keys.begin(), keys.end(), values.begin(), keys_out.begin(),
+      values_out.begin(), [](int a, int b) { return a / 10 == b / 10; },
+      [](float a, float b) { return a > b ? a : b; });
+
+  EXPECT_EQ(std::distance(keys_out.begin(), res.first), expected_keys.size());
+  EXPECT_TRUE(std::equal(expected_keys.begin(), expected_keys.end(),
+                         keys_out.begin()));
+  EXPECT_TRUE(std::equal(expected_values.begin(), expected_values.end(),
+                         values_out.begin()));
+}
+
+TEST_F(ReduceByKeyAlgorithm, TestSyclCountByKey) {
+  std::vector<int> keys(4000);
+  std::generate(keys.begin(), keys.end(), []() { return std::rand() % 100; });
+  std::sort(keys.begin(), keys.end());
+  std::vector<int> expected_keys;
+  std::vector<int> expected_counts;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (i == 0 || keys[i] != keys[i - 1]) {
+      expected_keys.push_back(keys[i]);
+      expected_counts.push_back(0);
+    }
+    expected_counts.back()++;
+  }
+  std::vector<int> keys_out(keys.size());
+  std::vector<int> counts_out(keys.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ReduceByKeyAlgorithm3> snp(q);
+  auto res = count_by_key(snp, keys.begin(), keys.end(), keys_out.begin(),
+                          counts_out.begin());
+
+  EXPECT_EQ(std::distance(keys_out.begin(), res.first), expected_keys.size());
+  EXPECT_TRUE(std::equal(expected_keys.begin(), expected_keys.end(),
+                         keys_out.begin()));
+  EXPECT_TRUE(std::equal(expected_counts.begin(), expected_counts.end(),
+                         counts_out.begin()));
+}
+
+struct SameTens {
+  bool operator()(int a, int b) const { return a / 10 == b / 10; }
+};
+
+TEST_F(ReduceByKeyAlgorithm, TestSyclCountByKeyFunctorName) {
+  std::vector<int> keys(4000);
+  std::generate(keys.begin(), keys.end(), []() { return std::rand() % 100; });
+  std::sort(keys.begin(), keys.end());
+  std::vector<int> expected_keys;
+  std::vector<int> expected_counts;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (i == 0 || keys[i] / 10 != keys[i - 1] / 10) {
+      expected_keys.push_back(keys[i]);
+      expected_counts.push_back(0);
+    }
+    expected_counts.back()++;
+  }
+  std::vector<int> keys_out(keys.size());
+  std::vector<int> counts_out(keys.size());
+
+  // the kernels are named after the predicate
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<> snp(q);
+  auto res = count_by_key(snp, keys.begin(), keys.end(), keys_out.begin(),
+                          counts_out.begin(), SameTens());
+
+  EXPECT_EQ(std::distance(keys_out.begin(), res.first), expected_keys.size());
+  EXPECT_TRUE(std::equal(expected_keys.begin(), expected_keys.end(),
+                         keys_out.begin()));
+  EXPECT_TRUE(std::equal(expected_counts.begin(), expected_counts.end(),
+                         counts_out.begin()));
+}
+
+struct SameFifties {
+  bool operator()(int a, int b) const { return a / 50 == b / 50; }
+};
+
+struct AddInts {
+  int operator()(int a, int b) const { return a + b; }
+};
+
+TEST_F(ReduceByKeyAlgorithm, TestSyclReduceByKeyFunctorNames) {
+  std::vector<int> keys(4000);
+  std::generate(keys.begin(), keys.end(), []() { return std::rand() % 100; });
+  std::sort(keys.begin(), keys.end());
+  std::vector<int> values(keys.size());
+  std::generate(values.begin(), values.end(),
+                []() { return std::rand() % 10; });
+  std::vector<int> keys_out(keys.size());
+  std::vector<int> values_out(keys.size());
+
+  // the kernels are named after both the predicate and the operation
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<> snp(q);
+  for (int width : {10, 50}) {
+    std::vector<int> expected_keys;
+    std::vector<int> expected_values;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (i == 0 || keys[i] / width != keys[i - 1] / width) {
+        expected_keys.push_back(keys[i]);
+        expected_values.push_back(0);
+      }
+      expected_values.back() += values[i];
+    }
+
+    auto res = (width == 10)
+                   ? reduce_by_key(snp, keys.begin(), keys.end(),
+                                   values.begin(), keys_out.begin(),
+                                   values_out.begin(), SameTens(), AddInts())
+                   : reduce_by_key(snp, keys.begin(), keys.end(),
+                                   values.begin(), keys_out.begin(),
+                                   values_out.begin(), SameFifties(),
+                                   AddInts());
+
+    EXPECT_EQ(std::distance(keys_out.begin(), res.first),
+              expected_keys.size());
+    EXPECT_TRUE(std::equal(expected_keys.begin(), expected_keys.end(),
+                           keys_out.begin()));
+    EXPECT_TRUE(std::equal(expected_values.begin(), expected_values.end(),
+                           values_out.begin()));
+  }
+}
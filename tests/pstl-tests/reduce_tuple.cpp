@@ -0,0 +1,110 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct ReduceTupleAlgorithm : public testing::Test {};
+
+struct Identity {
+  float operator()(float x) const { return x; }
+};
+
+struct One {
+  int operator()(float) const { return 1; }
+};
+
+struct Min {
+  float operator()(float a, float b) const { return a < b ? a : b; }
+};
+
+struct Max {
+  float operator()(float a, float b) const { return a < b ? b : a; }
+};
+
+struct Plus {
+  template <typename T>
+  T operator()(T a, T b) const {
+    return a + b;
+  }
+};
+
+TEST_F(ReduceTupleAlgorithm, TestSyclReduceTuple) {
+  for (size_t size : {1, 17, 1000, 5001}) {
+    std::vector<float> v(size);
+    std::generate(v.begin(), v.end(),
+                  []() { return static_cast<float>(std::rand() % 1000); });
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class ReduceTupleAlgorithm1> snp(q);
+    auto res = reduce(snp, v.begin(), v.end(),
+                      std::make_tuple(
+                          std::make_tuple(Identity(), Min(), 1e9f),
+                          std::make_tuple(Identity(), Max(), -1e9f),
+                          std::make_tuple(Identity(), Plus(), 0.0f),
+                          std::make_tuple(One(), Plus(), 0)));
+
+    EXPECT_EQ(std::get<0>(res), *std::min_element(v.begin(), v.end()));
+    EXPECT_EQ(std::get<1>(res), *std::max_element(v.begin(), v.end()));
+    EXPECT_EQ(std::get<2>(res),
+              std::accumulate(v.begin(), v.end(), 0.0f));
+    EXPECT_EQ(std::get<3>(res), static_cast<int>(size));
+  }
+}
+
+TEST_F(ReduceTupleAlgorithm, TestSyclReduceTupleInit) {
+  std::vector<int> v(2000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 10; });
+  long squares = 5;
+  for (int x : v) {
+    squares += x * x;
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ReduceTupleAlgorithm2> snp(q);
+  auto res = reduce(
+      snp, v.begin(), v.end(),
+      std::make_tuple(std::make_tuple([](int x) { return long(x) * x; },
+                                      [](long a, long b) { return a + b; },
+                                      5L)));
+
+  EXPECT_EQ(std::get<0>(res), squares);
+
+  std::vector<int> empty;
+  auto res_empty = reduce(
+      snp, empty.begin(), empty.end(),
+      std::make_tuple(std::make_tuple(Identity(), Plus(), 3.0f)));
+  EXPECT_EQ(std::get<0>(res_empty), 3.0f);
+}
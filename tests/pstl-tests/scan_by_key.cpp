@@ -0,0 +1,166 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct ScanByKeyAlgorithm : public testing::Test {};
+
+// keys made of runs of random length, as produced by a sort
+static std::vector<int> make_keys(size_t size) {
+  std::vector<int> keys(size);
+  int key = 0;
+  for (size_t i = 0; i < size; ++i) {
+    if (std::rand() % 7 == 0) {
+      key++;
+    }
+    keys[i] = key;
+  }
+  return keys;
+}
+
+TEST_F(ScanByKeyAlgorithm, TestSyclInclusiveScanByKey) {
+  for (size_t size : {1, 2, 17, 1000, 5001}) {
+    std::vector<int> keys = make_keys(size);
+    std::vector<int> values(size);
+    std::generate(values.begin(), values.end(),
+                  []() { return std::rand() % 10; });
+    std::vector<int> expected(size);
+    for (size_t i = 0; i < size; ++i) {
+      bool head = (i == 0) || (keys[i] != keys[i - 1]);
+      expected[i] = head ? values[i] : expected[i - 1] + values[i];
+    }
+    std::vector<int> out(size);
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class ScanByKeyAlgorithm1> snp(q);
+    auto last = inclusive_scan_by_key(snp, keys.begin(), keys.end(),
+                                      values.begin(), out.begin());
+
+    EXPECT_TRUE(last == out.end());
+    EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+  }
+}
+
+TEST_F(ScanByKeyAlgorithm, TestSyclExclusiveScanByKey) {
+  for (size_t size : {1, 2, 17, 1000, 5001}) {
+    std::vector<int> keys = make_keys(size);
+    std::vector<int> values(size);
+    std::generate(values.begin(), values.end(),
+                  []() { return std::rand() % 10; });
+    std::vector<int> expected(size);
+    for (size_t i = 0; i < size; ++i) {
+      bool head = (i == 0) || (keys[i] != keys[i - 1]);
+      expected[i] = head ? 3 : expected[i - 1] + values[i - 1];
+    }
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class ScanByKeyAlgorithm2> snp(q);
+    exclusive_scan_by_key(snp, keys.begin(), keys.end(), values.begin(),
+                          values.begin(), 3);
+
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), expected.begin()));
+  }
+}
+
+TEST_F(ScanByKeyAlgorithm, TestSyclScanByKeyCustomOperators) {
+  // keys within the same block of ten belong to the same segment
+  std::vector<int> keys(3000);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = static_cast<int>(i);
+  }
+  std::vector<int> values(keys.size());
+  std::generate(values.begin(), values.end(),
+                []() { return std::rand() % 1000; });
+  std::vector<int> expected(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    bool head = (i % 10 == 0);
+    expected[i] = head ? values[i] : std::max(expected[i - 1], values[i]);
+  }
+  std::vector<int> out(values.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class ScanByKeyAlgorithm3> snp(q);
+  inclusive_scan_by_key(snp, keys.begin(), keys.end(), values.begin(),
+                        out.begin(),
+                        [](int a, int b) { return a / 10 == b / 10; },
+                        [](int a, int b) { return a > b ? a : b; });
+
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+}
+
+struct SameBlock {
+  bool operator()(int a, int b) const { return a / 10 == b / 10; }
+};
+
+struct SameHalfBlock {
+  bool operator()(int a, int b) const { return a / 5 == b / 5; }
+};
+
+struct MaxOf {
+  int operator()(int a, int b) const { return a > b ? a : b; }
+};
+
+TEST_F(ScanByKeyAlgorithm, TestSyclScanByKeyFunctorNames) {
+  std::vector<int> keys(3000);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = static_cast<int>(i);
+  }
+  std::vector<int> values(keys.size());
+  std::generate(values.begin(), values.end(),
+                []() { return std::rand() % 1000; });
+  std::vector<int> expected(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    bool head = (i % 10 == 0);
+    expected[i] = head ? 0 : std::max(expected[i - 1], values[i - 1]);
+  }
+  std::vector<int> out(values.size());
+
+  // the kernels are named after the functors
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<> snp(q);
+  exclusive_scan_by_key(snp, keys.begin(), keys.end(), values.begin(),
+                        out.begin(), 0, SameBlock(), MaxOf());
+
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+
+  // the same operation with another predicate is another kernel
+  for (size_t i = 0; i < values.size(); ++i) {
+    bool head = (i % 5 == 0);
+    expected[i] = head ? 0 : std::max(expected[i - 1], values[i - 1]);
+  }
+  exclusive_scan_by_key(snp, keys.begin(), keys.end(), values.begin(),
+                        out.begin(), 0, SameHalfBlock(), MaxOf());
+
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+}
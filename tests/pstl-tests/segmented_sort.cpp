@@ -0,0 +1,102 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct SegmentedSortAlgorithm : public testing::Test {};
+
+TEST_F(SegmentedSortAlgorithm, TestSyclSegmentedSort) {
+  // Empty, single element, small and large segments
+  std::vector<size_t> offsets = {0, 0, 1, 10, 50, 51, 400, 1000};
+  std::vector<int> v(1500);
+  std::generate(v.begin(), v.end(), std::rand);
+  std::vector<int> expected(v);
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    size_t end = (i + 1 < offsets.size()) ? offsets[i + 1] : v.size();
+    std::sort(expected.begin() + offsets[i], expected.begin() + end);
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SegmentedSortAlgorithm1> snp(q);
+  segmented_sort(snp, v.begin(), v.end(), offsets.begin(), offsets.end());
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+TEST_F(SegmentedSortAlgorithm, TestSyclSegmentedSortComp) {
+  std::vector<int> offsets;
+  for (int i = 0; i < 1000; i += 7) {
+    offsets.push_back(i);
+  }
+  std::vector<float> v(1000);
+  std::generate(v.begin(), v.end(), std::rand);
+  std::vector<float> expected(v);
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    size_t end = (i + 1 < offsets.size()) ? offsets[i + 1] : v.size();
+    std::sort(expected.begin() + offsets[i], expected.begin() + end,
+              [](float a, float b) { return a > b; });
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SegmentedSortAlgorithm2> snp(q);
+  // Decreasing order
+  segmented_sort(snp, v.begin(), v.end(), offsets.begin(), offsets.end(),
+                 [](float a, float b) { return a < b; });
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+TEST_F(SegmentedSortAlgorithm, TestSyclSegmentedSortManySizes) {
+  // Thousands of segments of every size up to 40, then a large one
+  std::vector<size_t> offsets;
+  size_t size = 0;
+  for (size_t i = 0; i < 2000; ++i) {
+    offsets.push_back(size);
+    size += (i * 7) % 41;
+  }
+  offsets.push_back(size);
+  std::vector<int> v(size + 700);
+  std::generate(v.begin(), v.end(), std::rand);
+  std::vector<int> expected(v);
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    size_t end = (i + 1 < offsets.size()) ? offsets[i + 1] : v.size();
+    std::sort(expected.begin() + offsets[i], expected.begin() + end);
+  }
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SegmentedSortAlgorithm3> snp(q);
+  segmented_sort(snp, v.begin(), v.end(), offsets.begin(), offsets.end());
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
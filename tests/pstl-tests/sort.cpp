@@ -78,6 +78,15 @@ TEST_F(SortAlgorithm, TestSyclSort) {
   }
 }
 
+TEST_F(SortAlgorithm, TestSyclSortNonPowerOfTwo) {
+  for (size_t size : {17, 100, 1000, 1025}) {
+    std::vector<int> v(size);
+    std::generate(v.begin(), v.end(), std::rand);
+    sort(*sycl_policy, v.begin(), v.end());
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+  }
+}
+
 TEST_F(SortAlgorithm, TestSycl2Sort) {
   std::vector<int> v = {2, 1, 3, 7, 9, 5, 4};
 
@@ -97,3 +106,87 @@ TEST_F(SortAlgorithm, TestSycl3Sort) {
 
   EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
 }
+
+TEST_F(SortAlgorithm, TestSycl4Sort) {
+  std::vector<float> v(1000);
+  std::generate(v.begin(), v.end(), std::rand);
+  std::vector<float> expected(v);
+  std::sort(expected.begin(), expected.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SortAlgorithm4> snp(q);
+  sort(snp, v.begin(), v.end(), [=](float a, float b) { return a > b; });
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+TEST_F(SortAlgorithm, TestSyclRadixSortSigned) {
+  std::vector<int> v(1000);
+  std::generate(v.begin(), v.end(), [] { return std::rand() - RAND_MAX / 2; });
+  std::vector<int> expected(v);
+  std::sort(expected.begin(), expected.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SortAlgorithm5> snp(q);
+  sort(snp, v.begin(), v.end());
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+TEST_F(SortAlgorithm, TestSyclRadixSortUnsigned) {
+  std::vector<unsigned> v(777);
+  std::generate(v.begin(), v.end(),
+                [] { return static_cast<unsigned>(std::rand()) * 3u; });
+  std::vector<unsigned> expected(v);
+  std::sort(expected.begin(), expected.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SortAlgorithm6> snp(q);
+  sort(snp, v.begin(), v.end());
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
+
+TEST_F(SortAlgorithm, TestSyclRadixSortFloatingPoint) {
+  std::vector<float> v(513);
+  std::generate(v.begin(), v.end(),
+                [] { return (std::rand() - RAND_MAX / 2) / 100.0f; });
+  std::vector<float> expected(v);
+  std::sort(expected.begin(), expected.end());
+
+  std::vector<double> w(v.begin(), v.end());
+  std::vector<double> expectedW(expected.begin(), expected.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SortAlgorithm7> snp(q);
+  sort(snp, v.begin(), v.end());
+  sycl::sycl_execution_policy<class SortAlgorithm8> snp2(q);
+  sort(snp2, w.begin(), w.end());
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  EXPECT_TRUE(std::equal(w.begin(), w.end(), expectedW.begin()));
+}
+
+TEST_F(SortAlgorithm, TestSyclSortBufferSubRange) {
+  std::vector<int> v(1000);
+  std::generate(v.begin(), v.end(), std::rand);
+  std::vector<int> expected(v);
+  std::sort(expected.begin() + 100, expected.begin() + 900);
+  std::sort(expected.begin() + 950, expected.begin() + 960);
+  std::sort(expected.begin() + 10, expected.begin() + 50,
+            [](int a, int b) { return a > b; });
+
+  {
+    cl::sycl::buffer<int, 1> b(v.data(), cl::sycl::range<1>(v.size()));
+    auto first = sycl::helpers::begin(b);
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class SortAlgorithm9> snp(q);
+    sort(snp, first + 100, first + 900);
+    sort(snp, first + 950, first + 960);
+    sycl::sycl_execution_policy<class SortAlgorithm10> snp2(q);
+    sort(snp2, first + 10, first + 50, [](int a, int b) { return a < b; });
+  }
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+}
@@ -0,0 +1,113 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct SortByKeyAlgorithm : public testing::Test {};
+
+TEST_F(SortByKeyAlgorithm, TestSyclSortByKey) {
+  std::vector<int> keys(1000);
+  std::generate(keys.begin(), keys.end(), std::rand);
+  std::vector<float> values(keys.begin(), keys.end());
+  std::vector<int> expected(keys);
+  std::sort(expected.begin(), expected.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SortByKeyAlgorithm1> snp(q);
+  sort_by_key(snp, keys.begin(), keys.end(), values.begin());
+
+  EXPECT_TRUE(std::equal(keys.begin(), keys.end(), expected.begin()));
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(static_cast<float>(keys[i]), values[i]);
+  }
+}
+
+TEST_F(SortByKeyAlgorithm, TestSyclSortByKeyComp) {
+  std::vector<int> keys(100);
+  std::generate(keys.begin(), keys.end(), std::rand);
+  std::vector<int> values(keys.size());
+  std::iota(values.begin(), values.end(), 0);
+  std::vector<int> original(keys);
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SortByKeyAlgorithm2> snp(q);
+  // Decreasing order
+  sort_by_key(snp, keys.begin(), keys.end(), values.begin(),
+              [](int a, int b) { return a < b; });
+
+  EXPECT_TRUE(std::is_sorted(keys.rbegin(), keys.rend()));
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(original[values[i]], keys[i]);
+  }
+}
+
+TEST_F(SortByKeyAlgorithm, TestSyclStableSortByKey) {
+  std::vector<int> keys(555);
+  std::generate(keys.begin(), keys.end(), [] { return std::rand() % 10; });
+  std::vector<int> values(keys.size());
+  std::iota(values.begin(), values.end(), 0);
+
+  std::vector<int> expectedKeys(keys);
+  std::vector<int> expectedValues(values);
+  std::stable_sort(expectedValues.begin(), expectedValues.end(),
+                   [&](int a, int b) { return keys[a] < keys[b]; });
+  std::sort(expectedKeys.begin(), expectedKeys.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SortByKeyAlgorithm3> snp(q);
+  stable_sort_by_key(snp, keys.begin(), keys.end(), values.begin());
+
+  EXPECT_TRUE(std::equal(keys.begin(), keys.end(), expectedKeys.begin()));
+  EXPECT_TRUE(std::equal(values.begin(), values.end(), expectedValues.begin()));
+}
+
+TEST_F(SortByKeyAlgorithm, TestSyclSortByKeySamePolicy) {
+  std::vector<int> keys(200);
+  std::generate(keys.begin(), keys.end(), [] { return std::rand() % 20; });
+  std::vector<int> values(keys.size());
+  std::iota(values.begin(), values.end(), 0);
+  std::vector<int> keys2(keys);
+  std::vector<int> values2(values);
+  std::vector<int> expected(keys);
+  std::sort(expected.begin(), expected.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class SortByKeyAlgorithm4> snp(q);
+  sort_by_key(snp, keys.begin(), keys.end(), values.begin());
+  stable_sort_by_key(snp, keys2.begin(), keys2.end(), values2.begin());
+
+  EXPECT_TRUE(std::equal(keys.begin(), keys.end(), expected.begin()));
+  EXPECT_TRUE(std::equal(keys2.begin(), keys2.end(), expected.begin()));
+}
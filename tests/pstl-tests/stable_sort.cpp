@@ -0,0 +1,95 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct StableSortAlgorithm : public testing::Test {};
+
+struct record {
+  int key;
+  int position;
+};
+
+TEST_F(StableSortAlgorithm, TestSyclStableSort) {
+  for (size_t size : {1, 2, 17, 100, 1000, 1025}) {
+    std::vector<int> v(size);
+    std::generate(v.begin(), v.end(), std::rand);
+    std::vector<int> expected(v);
+    std::sort(expected.begin(), expected.end());
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class StableSortAlgorithm1> snp(q);
+    stable_sort(snp, v.begin(), v.end());
+
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  }
+}
+
+TEST_F(StableSortAlgorithm, TestSyclStableSortIsStable) {
+  std::vector<record> v(777);
+  for (size_t i = 0; i < v.size(); ++i) {
+    v[i].key = std::rand() % 16;
+    v[i].position = static_cast<int>(i);
+  }
+  std::vector<record> expected(v);
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](record a, record b) { return a.key < b.key; });
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class StableSortAlgorithm2> snp(q);
+  stable_sort(snp, v.begin(), v.end(),
+              [](record a, record b) { return a.key > b.key; });
+
+  for (size_t i = 0; i < v.size(); ++i) {
+    EXPECT_EQ(expected[i].key, v[i].key);
+    EXPECT_EQ(expected[i].position, v[i].position);
+  }
+}
+
+TEST_F(StableSortAlgorithm, TestSyclStableSortSamePolicy) {
+  std::vector<int> v(300);
+  std::generate(v.begin(), v.end(), std::rand);
+  std::vector<int> w(v);
+  std::vector<int> expected(v);
+  std::sort(expected.begin(), expected.end());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class StableSortAlgorithm3> snp(q);
+  stable_sort(snp, v.begin(), v.end());
+  stable_sort(snp, w.begin(), w.end(), [](int a, int b) { return a > b; });
+
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  EXPECT_TRUE(std::equal(w.begin(), w.end(), expected.begin()));
+}
@@ -0,0 +1,157 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+#include <sycl/execution_policy>
+#include <sycl/vector.hpp>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct SyclVectorAlgorithm : public testing::Test {};
+
+TEST_F(SyclVectorAlgorithm, TestSyclVectorAssign) {
+  std::vector<int> v = {5, 1, 4, 2, 3};
+  cl::sycl::queue q;
+  sycl::vector<int> dv(v.begin(), v.end(), q);
+
+  EXPECT_EQ(dv.size(), v.size());
+  EXPECT_EQ(std::distance(dv.begin(), dv.end()), v.size());
+  auto view = dv.get_host_view();
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), view.begin()));
+}
+
+TEST_F(SyclVectorAlgorithm, TestSyclVectorChain) {
+  std::vector<int> v(256);
+  std::iota(v.begin(), v.end(), 0);
+  cl::sycl::queue q;
+  sycl::vector<int> dv(v.begin(), v.end(), q);
+  sycl::sycl_execution_policy<class SyclVectorTransform> snp1(q);
+  sycl::sycl_execution_policy<class SyclVectorSort> snp2(q);
+  sycl::sycl_execution_policy<class SyclVectorReduce> snp3(q);
+
+  transform(snp1, dv.begin(), dv.end(), dv.begin(),
+            [](int x) { return 255 - x; });
+  sort(snp2, dv.begin(), dv.end());
+  {
+    auto view = dv.get_host_view();
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), view.begin()));
+  }
+  EXPECT_EQ(reduce(snp3, dv.begin(), dv.end()), 255 * 256 / 2);
+}
+
+TEST_F(SyclVectorAlgorithm, TestSyclVectorResize) {
+  cl::sycl::queue q;
+  sycl::vector<float> dv(q);
+  EXPECT_TRUE(dv.empty());
+
+  std::vector<float> a = {1, 2, 3};
+  std::vector<float> b = {4, 5};
+  dv.push_back(a.begin(), a.end());
+  dv.push_back(b.begin(), b.end());
+  dv.push_back(6.0f);
+  dv.resize(8, 7.0f);
+
+  std::vector<float> expected = {1, 2, 3, 4, 5, 6, 7, 7};
+  {
+    auto view = dv.get_host_view();
+    ASSERT_EQ(view.size(), expected.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), view.begin()));
+  }
+
+  sycl::vector<float> copy(dv);
+  dv.resize(2);
+  dv.assign(3, 9.0f);
+  EXPECT_EQ(dv.size(), 3u);
+  EXPECT_EQ(dv.get_host_view()[2], 9.0f);
+  auto view = copy.get_host_view();
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), view.begin()));
+}
+
+TEST_F(SyclVectorAlgorithm, TestSyclVectorTiles) {
+  const int size = 1024;
+  const int tile = 256;
+  std::vector<int> v(size);
+  std::iota(v.begin(), v.end(), 0);
+  cl::sycl::queue q;
+  sycl::vector<int> dv(v.begin(), v.end(), q);
+  sycl::sycl_execution_policy<class SyclVectorTileTransform> snp1(q);
+  sycl::sycl_execution_policy<class SyclVectorTileFill> snp2(q);
+  sycl::sycl_execution_policy<class SyclVectorTileReduce> snp3(q);
+
+  auto first = dv.begin();
+  for (int pos = 0; pos < size; pos += tile) {
+    transform(snp1, first + pos, first + (pos + tile), first + pos,
+              [](int x) { return 2 * x; });
+  }
+  fill(snp2, first + 10, first + 20, -1);
+  {
+    auto view = dv.get_host_view();
+    for (int i = 0; i < size; i++) {
+      EXPECT_EQ(view[i], (i >= 10 && i < 20) ? -1 : 2 * i);
+    }
+  }
+
+  for (int pos = tile; pos < size; pos += tile) {
+    int expected = 0;
+    for (int i = pos; i < pos + tile; i++) {
+      expected += 2 * i;
+    }
+    EXPECT_EQ(reduce(snp3, first + pos, first + (pos + tile)), expected);
+  }
+}
+
+TEST_F(SyclVectorAlgorithm, TestSyclVectorCapacity) {
+  cl::sycl::queue q;
+  sycl::vector<int> dv(q);
+  size_t reallocations = 0;
+  for (int i = 0; i < 1024; i++) {
+    size_t capacity = dv.capacity();
+    dv.push_back(i);
+    if (dv.capacity() != capacity) {
+      reallocations++;
+    }
+  }
+  EXPECT_EQ(dv.size(), 1024u);
+  EXPECT_GE(dv.capacity(), dv.size());
+  EXPECT_LE(reallocations, 11u);
+
+  // the algorithms only see the first size() elements of the buffer
+  sycl::sycl_execution_policy<class SyclVectorCapacityReduce> snp(q);
+  EXPECT_EQ(reduce(snp, dv.begin(), dv.end()), 1023 * 1024 / 2);
+
+  dv.clear();
+  EXPECT_TRUE(dv.empty());
+  EXPECT_GE(dv.capacity(), 1024u);
+  dv.reserve(5000);
+  EXPECT_GE(dv.capacity(), 5000u);
+  EXPECT_TRUE(dv.empty());
+}
@@ -0,0 +1,59 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct TransformExclusiveScanAlgorithm : public testing::Test {};
+
+TEST_F(TransformExclusiveScanAlgorithm, TestSyclTransformExclusiveScan) {
+  for (size_t size : {1, 2, 17, 1000, 5001}) {
+    std::vector<int> v(size);
+    std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+    std::vector<int> expected(size);
+    int acc = 7;
+    for (size_t i = 0; i < size; ++i) {
+      expected[i] = acc;
+      acc += v[i] % 3;
+    }
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class TransformExclusiveScanAlgorithm1> snp(q);
+    auto last = transform_exclusive_scan(
+        snp, v.begin(), v.end(), v.begin(), 7,
+        [](int a, int b) { return a + b; }, [](int x) { return x % 3; });
+
+    EXPECT_TRUE(last == v.end());
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  }
+}
@@ -0,0 +1,106 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+
+#include <sycl/execution_policy>
+#include <sycl/vector.hpp>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct TransformInclusiveScanAlgorithm : public testing::Test {};
+
+TEST_F(TransformInclusiveScanAlgorithm, TestSyclTransformInclusiveScan) {
+  for (size_t size : {1, 2, 17, 1000, 5001}) {
+    std::vector<int> v(size);
+    std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+    std::vector<int> expected(size);
+    int acc = 0;
+    for (size_t i = 0; i < size; ++i) {
+      acc += v[i] * v[i];
+      expected[i] = acc;
+    }
+    std::vector<int> out(size);
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class TransformInclusiveScanAlgorithm1> snp(q);
+    auto last = transform_inclusive_scan(
+        snp, v.begin(), v.end(), out.begin(),
+        [](int a, int b) { return a + b; }, [](int x) { return x * x; });
+
+    EXPECT_TRUE(last == out.end());
+    EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+  }
+}
+
+TEST_F(TransformInclusiveScanAlgorithm, TestSyclTransformInclusiveScanInit) {
+  std::vector<int> v(3000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+  std::vector<long> expected(v.size());
+  long acc = 42;
+  for (size_t i = 0; i < v.size(); ++i) {
+    acc += 2 * v[i];
+    expected[i] = acc;
+  }
+  std::vector<long> out(v.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class TransformInclusiveScanAlgorithm2> snp(q);
+  transform_inclusive_scan(snp, v.begin(), v.end(), out.begin(),
+                           [](long a, long b) { return a + b; },
+                           [](int x) { return 2L * x; }, 42L);
+
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+}
+
+TEST_F(TransformInclusiveScanAlgorithm, TestSyclTransformInclusiveScanMin) {
+  std::vector<int> v(5000);
+  std::generate(v.begin(), v.end(), []() { return 1 + std::rand() % 1000; });
+  std::vector<int> expected(v.size());
+  int acc = v[0] + 1;
+  for (size_t i = 0; i < v.size(); ++i) {
+    acc = std::min(acc, v[i] + 1);
+    expected[i] = acc;
+  }
+
+  // the first element is read on the device, not through the iterator
+  cl::sycl::queue q;
+  sycl::vector<int> dv(v.begin(), v.end(), q);
+  sycl::vector<int> out(v.size(), 0, q);
+  sycl::sycl_execution_policy<class TransformInclusiveScanAlgorithm3> snp(q);
+  auto last = transform_inclusive_scan(
+      snp, dv.begin(), dv.end(), out.begin(),
+      [](int a, int b) { return a < b ? a : b; },
+      [](int x) { return x + 1; });
+
+  EXPECT_TRUE(last == out.end());
+  auto view = out.get_host_view();
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), view.begin()));
+}
@@ -0,0 +1,124 @@
+/* Copyright (c) 2015-2018 The Khronos Group Inc.
+
+  Permission is hereby granted, free of charge, to any person obtaining a
+  copy of this software and/or associated documentation files (the
+  "Materials"), to deal in the Materials without restriction, including
+  without limitation the rights to use, copy, modify, merge, publish,
+  distribute, sublicense, and/or sell copies of the Materials, and to
+  permit persons to whom the Materials are furnished to do so, subject to
+  the following conditions:
+
+  The above copyright notice and this permission notice shall be included
+  in all copies or substantial portions of the Materials.
+
+  MODIFICATIONS TO THIS FILE MAY MEAN IT NO LONGER ACCURATELY REFLECTS
+  KHRONOS STANDARDS. THE UNMODIFIED, NORMATIVE VERSIONS OF KHRONOS
+  SPECIFICATIONS AND HEADER INFORMATION ARE LOCATED AT
+     https://www.khronos.org/registry/
+
+  THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+  CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+  TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+  MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+*/
+#include "gmock/gmock.h"
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+#include <sycl/execution_policy>
+#include <experimental/algorithm>
+
+using namespace std::experimental::parallel;
+
+struct UniqueAlgorithm : public testing::Test {};
+
+TEST_F(UniqueAlgorithm, TestSyclUnique) {
+  for (size_t size : {1, 2, 17, 1000, 5001}) {
+    std::vector<int> v(size);
+    std::generate(v.begin(), v.end(), []() { return std::rand() % 4; });
+    std::vector<int> expected(v);
+    expected.erase(std::unique(expected.begin(), expected.end()),
+                   expected.end());
+
+    cl::sycl::queue q;
+    sycl::sycl_execution_policy<class UniqueAlgorithm1> snp(q);
+    auto last = unique(snp, v.begin(), v.end());
+
+    EXPECT_EQ(std::distance(v.begin(), last), expected.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), v.begin()));
+  }
+}
+
+TEST_F(UniqueAlgorithm, TestSyclUniqueCopyPredicate) {
+  std::vector<int> v(3000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+  std::sort(v.begin(), v.end());
+  auto same_tens = [](int a, int b) { return a / 10 == b / 10; };
+  std::vector<int> expected;
+  std::unique_copy(v.begin(), v.end(), std::back_inserter(expected),
+                   same_tens);
+  std::vector<int> out(v.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class UniqueAlgorithm2> snp(q);
+  auto last = unique_copy(snp, v.begin(), v.end(), out.begin(), same_tens);
+
+  EXPECT_EQ(std::distance(out.begin(), last), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+}
+
+TEST_F(UniqueAlgorithm, TestSyclRunLengthEncode) {
+  std::vector<int> v(4000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 3; });
+  std::vector<int> expected_values;
+  std::vector<size_t> expected_counts;
+  for (size_t i = 0; i < v.size(); ++i) {
+    if (i == 0 || v[i] != v[i - 1]) {
+      expected_values.push_back(v[i]);
+      expected_counts.push_back(0);
+    }
+    expected_counts.back()++;
+  }
+  std::vector<int> values(v.size());
+  std::vector<size_t> counts(v.size());
+
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<class UniqueAlgorithm3> snp(q);
+  auto res = run_length_encode(snp, v.begin(), v.end(), values.begin(),
+                               counts.begin());
+
+  EXPECT_EQ(std::distance(values.begin(), res.first),
+            expected_values.size());
+  EXPECT_EQ(std::distance(counts.begin(), res.second),
+            expected_counts.size());
+  EXPECT_TRUE(std::equal(expected_values.begin(), expected_values.end(),
+                         values.begin()));
+  EXPECT_TRUE(std::equal(expected_counts.begin(), expected_counts.end(),
+                         counts.begin()));
+}
+
+struct SameTens {
+  bool operator()(int a, int b) const { return a / 10 == b / 10; }
+};
+
+TEST_F(UniqueAlgorithm, TestSyclUniqueFunctorName) {
+  std::vector<int> v(3000);
+  std::generate(v.begin(), v.end(), []() { return std::rand() % 100; });
+  std::sort(v.begin(), v.end());
+  std::vector<int> expected(v);
+  expected.erase(std::unique(expected.begin(), expected.end(), SameTens()),
+                 expected.end());
+
+  // the kernels are named after the predicate
+  cl::sycl::queue q;
+  sycl::sycl_execution_policy<> snp(q);
+  auto last = unique(snp, v.begin(), v.end(), SameTens());
+
+  EXPECT_EQ(std::distance(v.begin(), last), expected.size());
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), v.begin()));
+}